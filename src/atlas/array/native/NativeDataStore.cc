@@ -0,0 +1,137 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/array/native/NativeDataStore.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "eckit/utils/Translator.h"
+
+//------------------------------------------------------------------------------
+
+namespace atlas {
+namespace array {
+namespace native {
+
+MemoryPool& MemoryPool::instance() {
+    // Never destroyed: arrays held by other static objects may still be deallocated after exit() starts
+    static MemoryPool* _instance = new MemoryPool();
+    return *_instance;
+}
+
+MemoryPool::MemoryPool() {
+    if ( ::getenv( "ATLAS_MEMORY_POOL" ) ) {
+        enabled_ = eckit::Translator<std::string, bool>()( ::getenv( "ATLAS_MEMORY_POOL" ) );
+    }
+    if ( ::getenv( "ATLAS_MEMORY_POOL_MAX_CACHED" ) ) {
+        max_cached_ = size_t( eckit::Translator<std::string, long>()( ::getenv( "ATLAS_MEMORY_POOL_MAX_CACHED" ) ) );
+    }
+}
+
+void MemoryPool::enable( bool enabled ) {
+    enabled_ = enabled;
+    if ( not enabled ) {
+        release();
+    }
+}
+
+void MemoryPool::max_cached( size_t bytes ) {
+    max_cached_ = bytes;
+    bool exceeded;
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        exceeded = cached_ > bytes;
+    }
+    if ( exceeded ) {
+        release();
+    }
+}
+
+size_t MemoryPool::size_class( size_t bytes ) {
+    size_t power = 256;
+    while ( power < bytes ) {
+        power <<= 1;
+    }
+    if ( power == 256 ) {
+        return power;
+    }
+    // bytes lies in ( power/2, power ], which is divided in four size classes
+    const size_t step = power / 8;
+    return ( ( bytes + step - 1 ) / step ) * step;
+}
+
+void* MemoryPool::allocate( size_t bytes, size_t alignment ) {
+    auto& watermark        = MemoryHighWatermark::instance();
+    const size_t blocksize = size_class( bytes );
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        auto& cached = blocks_[std::make_pair( alignment, blocksize )];
+        if ( not cached.empty() ) {
+            void* ptr = cached.back();
+            cached.pop_back();
+            cached_ -= blocksize;
+            watermark.pooled_ -= blocksize;
+            ++watermark.pool_hits_;
+            return ptr;
+        }
+    }
+    ++watermark.pool_misses_;
+    void* ptr = nullptr;
+    if ( posix_memalign( &ptr, alignment, blocksize ) ) {
+        // Memory may be held by cached blocks of other size classes
+        release();
+        if ( posix_memalign( &ptr, alignment, blocksize ) ) {
+            return nullptr;
+        }
+    }
+    return ptr;
+}
+
+void MemoryPool::deallocate( void* ptr, size_t bytes, size_t alignment ) {
+    if ( ptr == nullptr ) {
+        return;
+    }
+    if ( not enabled_ ) {
+        free( ptr );
+        return;
+    }
+    const size_t blocksize = size_class( bytes );
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        if ( cached_ + blocksize <= max_cached_ ) {
+            blocks_[std::make_pair( alignment, blocksize )].emplace_back( ptr );
+            cached_ += blocksize;
+            MemoryHighWatermark::instance().pooled_ += blocksize;
+            return;
+        }
+    }
+    free( ptr );
+}
+
+void MemoryPool::release() {
+    std::lock_guard<std::mutex> lock( mutex_ );
+    size_t released = 0;
+    for ( auto& cached : blocks_ ) {
+        for ( void* ptr : cached.second ) {
+            free( ptr );
+        }
+        released += cached.first.second * cached.second.size();
+    }
+    blocks_.clear();
+    cached_ = 0;
+    MemoryHighWatermark::instance().pooled_ -= released;
+}
+
+//------------------------------------------------------------------------------
+
+}  // namespace native
+}  // namespace array
+}  // namespace atlas
@@ -14,7 +14,11 @@
 #include <atomic>
 #include <cstdlib>  // posix_memalign
 #include <limits>   // std::numeric_limits<T>::signaling_NaN
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "atlas/array/ArrayUtil.h"
 #include "atlas/library/config.h"
@@ -31,7 +35,16 @@ namespace native {
 struct MemoryHighWatermark {
     std::atomic<size_t> bytes_{0};
     std::atomic<size_t> high_{0};
-    void print( std::ostream& out ) const { out << eckit::Bytes( double( bytes_ ) ); }
+    std::atomic<size_t> pooled_{0};       // bytes kept in the MemoryPool for reuse
+    std::atomic<size_t> pool_hits_{0};    // allocations served from the MemoryPool
+    std::atomic<size_t> pool_misses_{0};  // allocations by the MemoryPool from the system
+    void print( std::ostream& out ) const {
+        out << eckit::Bytes( double( bytes_ ) );
+        if ( pool_hits_ || pool_misses_ ) {
+            out << " (memory pool: " << eckit::Bytes( double( pooled_ ) ) << " cached, " << pool_hits_ << " reused, "
+                << pool_misses_ << " allocated)";
+        }
+    }
     friend std::ostream& operator<<( std::ostream& out, const MemoryHighWatermark& v ) {
         v.print( out );
         return out;
@@ -65,6 +78,51 @@ public:
     }
 };
 
+/// @brief Pool of aligned memory blocks for DataStore, recycled by size class
+///
+/// Freed blocks are kept to serve later allocations of the same size class and alignment, which avoids repeated
+/// system allocations and page faults for arrays that are created and destroyed over and over again, e.g. temporary
+/// fields within a time loop. Sizes are rounded up to one of four size classes per power of two, wasting at most
+/// 25% of an allocation. Statistics are reported through MemoryHighWatermark.
+///
+/// The pool is disabled by default. It is enabled with the environment variable ATLAS_MEMORY_POOL=1, or with the
+/// configuration "memory.pool" passed to atlas::Library::initialise(). At most 1 GiB of blocks is cached, or the
+/// number of bytes given by ATLAS_MEMORY_POOL_MAX_CACHED or the configuration "memory.pool_max_cached".
+/// Cached blocks are released by atlas::Library::finalise(); the pool itself is never destroyed.
+class MemoryPool {
+public:
+    static MemoryPool& instance();
+
+    bool enabled() const { return enabled_; }
+
+    /// @brief Enable or disable the pool; disabling releases all cached blocks
+    void enable( bool );
+
+    /// @brief Allocate at least given bytes with given alignment; returns nullptr on failure
+    void* allocate( size_t bytes, size_t alignment );
+
+    /// @brief Return a block obtained with allocate(), with the same bytes and alignment
+    void deallocate( void*, size_t bytes, size_t alignment );
+
+    /// @brief Return all cached blocks to the system
+    void release();
+
+    /// @brief Maximum bytes of cached blocks; blocks returned beyond it are freed instead of cached
+    size_t max_cached() const { return max_cached_; }
+    void max_cached( size_t bytes );
+
+    static size_t size_class( size_t bytes );
+
+private:
+    MemoryPool();
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<size_t> max_cached_{size_t( 1 ) << 30};
+    size_t cached_{0};  // bytes of cached blocks, guarded by mutex_
+    std::mutex mutex_;
+    std::map<std::pair<size_t, size_t>, std::vector<void*>> blocks_;  // (alignment, size class) -> cached blocks
+};
+
 template <typename Value>
 static constexpr Value invalid_value() {
     return std::numeric_limits<Value>::has_signaling_NaN
@@ -124,19 +182,35 @@ private:
         throw_Exception( ss.str(), loc );
     }
 
+    static constexpr size_t alignment() { return 64 * sizeof( Value ); }
+
     void alloc_aligned( Value*& ptr, size_t n ) {
-        const size_t alignment = 64 * sizeof( Value );
-        size_t bytes           = sizeof( Value ) * n;
+        size_t bytes = sizeof( Value ) * n;
         MemoryHighWatermark::instance() += bytes;
 
-        int err = posix_memalign( (void**)&ptr, alignment, bytes );
+        auto& pool = MemoryPool::instance();
+        if ( bytes && pool.enabled() ) {
+            ptr = static_cast<Value*>( pool.allocate( bytes, alignment() ) );
+            if ( ptr == nullptr ) {
+                throw_AllocationFailed( bytes, Here() );
+            }
+            pooled_ = true;
+            return;
+        }
+
+        int err = posix_memalign( (void**)&ptr, alignment(), bytes );
         if ( err ) {
             throw_AllocationFailed( bytes, Here() );
         }
     }
 
     void free_aligned( Value*& ptr ) {
-        free( ptr );
+        if ( pooled_ ) {
+            MemoryPool::instance().deallocate( ptr, footprint(), alignment() );
+        }
+        else {
+            free( ptr );
+        }
         ptr = nullptr;
         MemoryHighWatermark::instance() -= footprint();
     }
@@ -145,6 +219,7 @@ private:
 
     Value* data_store_;
     size_t size_;
+    bool pooled_{false};  // allocated by the MemoryPool, which may have been disabled since
 };
 
 //------------------------------------------------------------------------------
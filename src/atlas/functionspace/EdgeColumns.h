@@ -69,6 +69,8 @@ public:
 
     virtual void haloExchange( const FieldSet&, bool on_device = false ) const override;
     virtual void haloExchange( const Field&, bool on_device = false ) const override;
+    virtual parallel::HaloExchangeHandle startHaloExchange( const FieldSet&,
+                                                            bool on_device = false ) const override;
     const parallel::HaloExchange& halo_exchange() const;
 
     void gather( const FieldSet&, FieldSet& ) const;
@@ -11,7 +11,9 @@
 
 #include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/detail/FunctionSpaceImpl.h"
+#include "atlas/parallel/HaloExchange.h"
 
 namespace atlas {
 
@@ -75,6 +77,16 @@ void FunctionSpace::haloExchange( const FieldSet& fields, bool on_device ) const
     return get()->haloExchange( fields, on_device );
 }
 
+parallel::HaloExchangeHandle FunctionSpace::startHaloExchange( const FieldSet& fields, bool on_device ) const {
+    return get()->startHaloExchange( fields, on_device );
+}
+
+parallel::HaloExchangeHandle FunctionSpace::startHaloExchange( const Field& field, bool on_device ) const {
+    FieldSet fields;
+    fields.add( field );
+    return get()->startHaloExchange( fields, on_device );
+}
+
 void FunctionSpace::adjointHaloExchange( const FieldSet& fields, bool on_device ) const {
     return get()->adjointHaloExchange( fields, on_device );
 }
@@ -30,6 +30,9 @@ namespace util {
 class PartitionPolygon;
 class PartitionPolygons;
 }  // namespace util
+namespace parallel {
+class HaloExchangeHandle;
+}
 }  // namespace atlas
 
 namespace atlas {
@@ -60,6 +63,11 @@ public:
     void haloExchange( const FieldSet&, bool on_device = false ) const;
     void haloExchange( const Field&, bool on_device = false ) const;
 
+    /// Start a halo exchange without waiting for its completion. Halo values are only valid
+    /// after calling wait() on the returned handle, which must not outlive this function space.
+    parallel::HaloExchangeHandle startHaloExchange( const FieldSet&, bool on_device = false ) const;
+    parallel::HaloExchangeHandle startHaloExchange( const Field&, bool on_device = false ) const;
+
     void adjointHaloExchange( const FieldSet&, bool on_device = false ) const;
     void adjointHaloExchange( const Field&, bool on_device = false ) const;
 
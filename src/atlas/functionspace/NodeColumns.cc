@@ -66,6 +66,29 @@ array::LocalView<T, 3> make_leveled_view( Field& field ) {
     }
 }
 
+/// Gather all fields of given data type at once, each on the task given by its "owner" metadata
+template <typename T>
+void gather_fields( const parallel::GatherScatter& gather, const FieldSet& local_fieldset, FieldSet& global_fieldset ) {
+    std::vector<parallel::Field<T const>> loc_fields;
+    std::vector<parallel::Field<T>> glb_fields;
+    std::vector<idx_t> roots;
+    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
+        const Field& loc = local_fieldset[f];
+        Field& glb       = global_fieldset[f];
+        if ( loc.datatype() != array::DataType::kind<T>() ) {
+            continue;
+        }
+        idx_t root( 0 );
+        glb.metadata().get( "owner", root );
+        loc_fields.emplace_back( make_leveled_view<const T>( loc ) );
+        glb_fields.emplace_back( make_leveled_view<T>( glb ) );
+        roots.emplace_back( root );
+    }
+    if ( not roots.empty() ) {
+        gather.gather( loc_fields.data(), glb_fields.data(), static_cast<idx_t>( roots.size() ), roots.data() );
+    }
+}
+
 }  // namespace
 
 class NodeColumnsHaloExchangeCache : public util::Cache<std::string, parallel::HaloExchange>,
@@ -338,49 +361,38 @@ Field NodeColumns::createField( const Field& other, const eckit::Configuration&
                         option::variables( other.variables() ) | config );
 }
 
-namespace {
-
-template <int RANK>
-void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exchange, bool on_device ) {
-    if ( field.datatype() == array::DataType::kind<int>() ) {
-        halo_exchange.template execute<int, RANK>( field.array(), on_device );
-    }
-    else if ( field.datatype() == array::DataType::kind<long>() ) {
-        halo_exchange.template execute<long, RANK>( field.array(), on_device );
-    }
-    else if ( field.datatype() == array::DataType::kind<float>() ) {
-        halo_exchange.template execute<float, RANK>( field.array(), on_device );
-    }
-    else if ( field.datatype() == array::DataType::kind<double>() ) {
-        halo_exchange.template execute<double, RANK>( field.array(), on_device );
+void NodeColumns::haloExchange( const FieldSet& fieldset, bool on_device ) const {
+    std::vector<array::Array*> arrays;
+    arrays.reserve( fieldset.size() );
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = const_cast<FieldSet&>( fieldset )[f];
+        arrays.push_back( &field.array() );
     }
-    else {
-        throw_Exception( "datatype not supported", Here() );
+    halo_exchange().execute( arrays, on_device );
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        const_cast<FieldSet&>( fieldset )[f].set_dirty( false );
     }
-    field.set_dirty( false );
 }
-}  // namespace
 
-void NodeColumns::haloExchange( const FieldSet& fieldset, bool on_device ) const {
+parallel::HaloExchangeHandle NodeColumns::startHaloExchange( const FieldSet& fieldset, bool on_device ) const {
+    if ( on_device ) {
+        haloExchange( fieldset, on_device );
+        return parallel::HaloExchangeHandle();
+    }
+    std::vector<array::Array*> arrays;
+    arrays.reserve( fieldset.size() );
     for ( idx_t f = 0; f < fieldset.size(); ++f ) {
         Field& field = const_cast<FieldSet&>( fieldset )[f];
-        switch ( field.rank() ) {
-            case 1:
-                dispatch_haloExchange<1>( field, halo_exchange(), on_device );
-                break;
-            case 2:
-                dispatch_haloExchange<2>( field, halo_exchange(), on_device );
-                break;
-            case 3:
-                dispatch_haloExchange<3>( field, halo_exchange(), on_device );
-                break;
-            case 4:
-                dispatch_haloExchange<4>( field, halo_exchange(), on_device );
-                break;
-            default:
-                throw_Exception( "Rank not supported", Here() );
-        }
+        arrays.push_back( &field.array() );
     }
+    parallel::HaloExchangeHandle handle = halo_exchange().execute_start( arrays );
+    FieldSet fields                     = fieldset;
+    handle.on_completion( [fields]() mutable {
+        for ( idx_t f = 0; f < fields.size(); ++f ) {
+            fields[f].set_dirty( false );
+        }
+    } );
+    return handle;
 }
 
 void NodeColumns::haloExchange( const Field& field, bool on_device ) const {
@@ -400,36 +412,18 @@ void NodeColumns::gather( const FieldSet& local_fieldset, FieldSet& global_field
     ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
 
     for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<const int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<const long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<const float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<const double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
+        const auto datatype = local_fieldset[f].datatype();
+        if ( datatype != array::DataType::kind<int>() && datatype != array::DataType::kind<long>() &&
+             datatype != array::DataType::kind<float>() && datatype != array::DataType::kind<double>() ) {
             throw_Exception( "datatype not supported", Here() );
         }
     }
+
+    // Fields of the same data type are gathered together, possibly to different roots
+    gather_fields<int>( gather(), local_fieldset, global_fieldset );
+    gather_fields<long>( gather(), local_fieldset, global_fieldset );
+    gather_fields<float>( gather(), local_fieldset, global_fieldset );
+    gather_fields<double>( gather(), local_fieldset, global_fieldset );
 }
 
 void NodeColumns::gather( const Field& local, Field& global ) const {
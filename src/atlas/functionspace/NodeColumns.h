@@ -83,6 +83,7 @@ public:
 
     void haloExchange( const FieldSet&, bool on_device = false ) const override;
     void haloExchange( const Field&, bool on_device = false ) const override;
+    parallel::HaloExchangeHandle startHaloExchange( const FieldSet&, bool on_device = false ) const override;
     const parallel::HaloExchange& halo_exchange() const;
 
     void gather( const FieldSet&, FieldSet& ) const;
@@ -9,12 +9,16 @@
  */
 
 
+#include <algorithm>
+
 #include "atlas/functionspace/PointCloud.h"
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Iterator.h"
 #include "atlas/option/Options.h"
+#include "atlas/projection/Projection.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/CoordinateEnums.h"
 
@@ -60,12 +64,16 @@ PointCloud::PointCloud( const Grid& grid ) {
     lonlat_     = Field( "lonlat", array::make_datatype<double>(), array::make_shape( grid.size(), 2 ) );
     auto lonlat = array::make_view<double, 2>( lonlat_ );
 
-    idx_t j{0};
-    for ( auto p : grid.lonlat() ) {
-        lonlat( j, 0 ) = p.lon();
-        lonlat( j, 1 ) = p.lat();
-        ++j;
+    const gidx_t size       = grid.size();
+    const gidx_t block_size = 4096;
+    const gidx_t nb_blocks  = ( size + block_size - 1 ) / block_size;
+    atlas_omp_parallel_for( gidx_t block = 0; block < nb_blocks; ++block ) {
+        const gidx_t begin = block * block_size;
+        const gidx_t end   = std::min( begin + block_size, size );
+        grid.xy().fill( begin, end, lonlat.data() + 2 * begin );
     }
+    // Projections may not be usable concurrently (e.g. PROJ), so convert all points at once
+    grid.projection().xy2lonlat( lonlat.data(), lonlat.data(), size_t( size ) );
 }
 
 Field PointCloud::ghost() const {
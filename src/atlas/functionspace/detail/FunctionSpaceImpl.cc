@@ -11,6 +11,7 @@
 #include "FunctionSpaceImpl.h"
 #include "atlas/field/Field.h"
 #include "atlas/option/Options.h"
+#include "atlas/parallel/HaloExchange.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Metadata.h"
 
@@ -37,6 +38,11 @@ void FunctionSpaceImpl::haloExchange( const Field&, bool ) const {
     ATLAS_NOTIMPLEMENTED;
 }
 
+parallel::HaloExchangeHandle FunctionSpaceImpl::startHaloExchange( const FieldSet& fieldset, bool on_device ) const {
+    haloExchange( fieldset, on_device );
+    return parallel::HaloExchangeHandle();
+}
+
 void FunctionSpaceImpl::adjointHaloExchange( const FieldSet&, bool ) const {
     ATLAS_NOTIMPLEMENTED;
 }
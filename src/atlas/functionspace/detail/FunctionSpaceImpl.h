@@ -31,6 +31,9 @@ class Metadata;
 class PartitionPolygon;
 class PartitionPolygons;
 }  // namespace util
+namespace parallel {
+class HaloExchangeHandle;
+}
 }  // namespace atlas
 
 namespace atlas {
@@ -75,6 +78,9 @@ public:
     virtual void haloExchange( const FieldSet&, bool /*on_device*/ = false ) const;
     virtual void haloExchange( const Field&, bool /* on_device*/ = false ) const;
 
+    /// Default implementation performs a blocking halo exchange and returns a completed handle
+    virtual parallel::HaloExchangeHandle startHaloExchange( const FieldSet&, bool /*on_device*/ = false ) const;
+
     virtual void adjointHaloExchange( const FieldSet&, bool /*on_device*/ = false ) const;
     virtual void adjointHaloExchange( const Field&, bool /* on_device*/ = false ) const;
 
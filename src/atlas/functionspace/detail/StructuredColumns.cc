@@ -70,6 +70,29 @@ array::LocalView<T, 3> make_leveled_view( Field& field ) {
     }
 }
 
+/// Gather all fields of given data type at once, each on the task given by its "owner" metadata
+template <typename T>
+void gather_fields( const parallel::GatherScatter& gather, const FieldSet& local_fieldset, FieldSet& global_fieldset ) {
+    std::vector<parallel::Field<T const>> loc_fields;
+    std::vector<parallel::Field<T>> glb_fields;
+    std::vector<idx_t> roots;
+    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
+        const Field& loc = local_fieldset[f];
+        Field& glb       = global_fieldset[f];
+        if ( loc.datatype() != array::DataType::kind<T>() ) {
+            continue;
+        }
+        idx_t root( 0 );
+        glb.metadata().get( "owner", root );
+        loc_fields.emplace_back( make_leveled_view<const T>( loc ) );
+        glb_fields.emplace_back( make_leveled_view<T>( glb ) );
+        roots.emplace_back( root );
+    }
+    if ( not roots.empty() ) {
+        gather.gather( loc_fields.data(), glb_fields.data(), static_cast<idx_t>( roots.size() ), roots.data() );
+    }
+}
+
 template <typename T>
 std::string checksum_3d_field( const parallel::Checksum& checksum, const Field& field ) {
     auto values = make_leveled_view<const T>( field );
@@ -533,36 +556,18 @@ void StructuredColumns::gather( const FieldSet& local_fieldset, FieldSet& global
     ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
 
     for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<const int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<const long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<const float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<const double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
+        const auto datatype = local_fieldset[f].datatype();
+        if ( datatype != array::DataType::kind<int>() && datatype != array::DataType::kind<long>() &&
+             datatype != array::DataType::kind<float>() && datatype != array::DataType::kind<double>() ) {
             throw_Exception( "datatype not supported", Here() );
         }
     }
+
+    // Fields of the same data type are gathered together, possibly to different roots
+    gather_fields<int>( gather(), local_fieldset, global_fieldset );
+    gather_fields<long>( gather(), local_fieldset, global_fieldset );
+    gather_fields<float>( gather(), local_fieldset, global_fieldset );
+    gather_fields<double>( gather(), local_fieldset, global_fieldset );
 }
 // ----------------------------------------------------------------------------
 
@@ -744,22 +749,18 @@ struct FixupHaloForVectors<3> {
 
 
 template <int RANK>
-void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exchange, const StructuredColumns& fs ) {
+void dispatch_fixupHalo( Field& field, const StructuredColumns& fs ) {
     FixupHaloForVectors<RANK> fixup_halos( fs );
     if ( field.datatype() == array::DataType::kind<int>() ) {
-        halo_exchange.template execute<int, RANK>( field.array(), false );
         fixup_halos.template apply<int>( field );
     }
     else if ( field.datatype() == array::DataType::kind<long>() ) {
-        halo_exchange.template execute<long, RANK>( field.array(), false );
         fixup_halos.template apply<long>( field );
     }
     else if ( field.datatype() == array::DataType::kind<float>() ) {
-        halo_exchange.template execute<float, RANK>( field.array(), false );
         fixup_halos.template apply<float>( field );
     }
     else if ( field.datatype() == array::DataType::kind<double>() ) {
-        halo_exchange.template execute<double, RANK>( field.array(), false );
         fixup_halos.template apply<double>( field );
     }
     else {
@@ -797,20 +798,44 @@ void dispatch_adjointHaloExchange( Field& field, const parallel::HaloExchange& h
 }  // namespace
 
 void StructuredColumns::haloExchange( const FieldSet& fieldset, bool ) const {
+    std::vector<array::Array*> arrays;
+    arrays.reserve( fieldset.size() );
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = const_cast<FieldSet&>( fieldset )[f];
+        arrays.push_back( &field.array() );
+    }
+    halo_exchange().execute( arrays, false );
+    fixupHalo( fieldset );
+}
+
+parallel::HaloExchangeHandle StructuredColumns::startHaloExchange( const FieldSet& fieldset, bool ) const {
+    std::vector<array::Array*> arrays;
+    arrays.reserve( fieldset.size() );
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = const_cast<FieldSet&>( fieldset )[f];
+        arrays.push_back( &field.array() );
+    }
+    parallel::HaloExchangeHandle handle = halo_exchange().execute_start( arrays );
+    FieldSet fields                     = fieldset;
+    handle.on_completion( [this, fields]() { fixupHalo( fields ); } );
+    return handle;
+}
+
+void StructuredColumns::fixupHalo( const FieldSet& fieldset ) const {
     for ( idx_t f = 0; f < fieldset.size(); ++f ) {
         Field& field = const_cast<FieldSet&>( fieldset )[f];
         switch ( field.rank() ) {
             case 1:
-                dispatch_haloExchange<1>( field, halo_exchange(), *this );
+                dispatch_fixupHalo<1>( field, *this );
                 break;
             case 2:
-                dispatch_haloExchange<2>( field, halo_exchange(), *this );
+                dispatch_fixupHalo<2>( field, *this );
                 break;
             case 3:
-                dispatch_haloExchange<3>( field, halo_exchange(), *this );
+                dispatch_fixupHalo<3>( field, *this );
                 break;
             case 4:
-                dispatch_haloExchange<4>( field, halo_exchange(), *this );
+                dispatch_fixupHalo<4>( field, *this );
                 break;
             default:
                 throw_Exception( "Rank not supported", Here() );
@@ -97,6 +97,8 @@ public:
 
     virtual void haloExchange( const FieldSet&, bool on_device = false ) const override;
     virtual void haloExchange( const Field&, bool on_device = false ) const override;
+    virtual parallel::HaloExchangeHandle startHaloExchange( const FieldSet&,
+                                                            bool on_device = false ) const override;
 
     virtual void adjointHaloExchange( const FieldSet&, bool on_device = false ) const override;
     virtual void adjointHaloExchange( const Field&, bool on_device = false ) const override;
@@ -197,6 +199,9 @@ private:  // methods
     const parallel::Checksum& checksum() const;
     const parallel::HaloExchange& halo_exchange() const;
 
+    /// Fix up halo values across the poles after a halo exchange, e.g. sign of vector components
+    void fixupHalo( const FieldSet& ) const;
+
     void create_remote_index() const;
 
 private:  // data
@@ -142,6 +142,13 @@ public:
     PointXY front() { return *begin(); }
     PointXY back() { return *( begin() + ( grid_.size() - 1 ) ); }
 
+    /// Fill buffer with the xy coordinates of the grid points with global index in [begin,end)
+    /// Separate blocks can be filled concurrently, e.g. within an OpenMP loop.
+    void fill( gidx_t begin, gidx_t end, double xy[] ) const { grid_.xy_range( begin, end, xy ); }
+    void fill( gidx_t begin, gidx_t end, PointXY xy[] ) const {
+        grid_.xy_range( begin, end, reinterpret_cast<double*>( xy ) );
+    }
+
 private:
     const Grid& grid_;
 };
@@ -159,6 +166,14 @@ public:
     PointLonLat front() { return *begin(); }
     PointLonLat back() { return *( begin() + ( grid_.size() - 1 ) ); }
 
+    /// Fill buffer with the lonlat coordinates of the grid points with global index in [begin,end)
+    /// Separate blocks can be filled concurrently, but the projection may serialise these calls (e.g. PROJ).
+    /// For large arrays prefer filling xy concurrently, followed by a single Projection::xy2lonlat call.
+    void fill( gidx_t begin, gidx_t end, double lonlat[] ) const { grid_.lonlat_range( begin, end, lonlat ); }
+    void fill( gidx_t begin, gidx_t end, PointLonLat lonlat[] ) const {
+        grid_.lonlat_range( begin, end, reinterpret_cast<double*>( lonlat ) );
+    }
+
 private:
     const Grid& grid_;
 };
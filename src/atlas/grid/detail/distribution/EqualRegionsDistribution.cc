@@ -0,0 +1,193 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "EqualRegionsDistribution.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include "atlas/grid/Grid.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace distribution {
+
+namespace {
+
+struct BandRow {
+    idx_t j;
+    idx_t i_begin;
+    idx_t i_end;
+    int y;
+};
+
+}  // namespace
+
+EqualRegionsDistribution::EqualRegionsDistribution( const Grid& grid, idx_t nb_partitions,
+                                                    const std::vector<int>& nb_regions_per_band ) :
+    DistributionFunctionT<EqualRegionsDistribution>( grid ), grid_( grid ) {
+    ATLAS_TRACE( "EqualRegionsDistribution" );
+    ATLAS_ASSERT( grid_ );
+    using util::microdeg;
+
+    type_          = "equal_regions";
+    size_          = grid.size();
+    nb_partitions_ = nb_partitions;
+
+    const idx_t ny = grid_.ny();
+    row_begin_.resize( ny + 1 );
+    y_.resize( ny );
+    row_begin_[0] = 0;
+    for ( idx_t j = 0; j < ny; ++j ) {
+        row_begin_[j + 1] = row_begin_[j] + grid_.nx( j );
+        y_[j]             = microdeg( grid_.y( j ) );
+    }
+
+    // Number of points of each partition, and ranges of global indices of each band, as in
+    // EqualRegionsPartitioner::partition( grid, part[] )
+    const idx_t nb_bands    = static_cast<idx_t>( nb_regions_per_band.size() );
+    const gidx_t chunk_size = size_ / nb_partitions_;
+    gidx_t remainder        = size_ - chunk_size * nb_partitions_;
+    std::vector<gidx_t> partition_begin;
+    partition_begin.reserve( nb_partitions_ + 1 );
+    nb_pts_.reserve( nb_partitions_ );
+    band_begin_.reserve( nb_bands + 1 );
+    band_partition_begin_.reserve( nb_bands + 1 );
+    gidx_t end = 0;
+    int p      = 0;
+    for ( idx_t b = 0; b < nb_bands; ++b ) {
+        band_begin_.emplace_back( end );
+        band_partition_begin_.emplace_back( p );
+        for ( int r = 0; r < nb_regions_per_band[b]; ++r, ++p ) {
+            gidx_t count = chunk_size + ( remainder-- > 0 ? 1 : 0 );
+            partition_begin.emplace_back( end );
+            nb_pts_.emplace_back( count );
+            end += count;
+        }
+    }
+    band_begin_.emplace_back( end );
+    band_partition_begin_.emplace_back( p );
+    partition_begin.emplace_back( end );
+    ATLAS_ASSERT( p == nb_partitions_ );
+    ATLAS_ASSERT( end == size_ );
+
+    max_pts_ = *std::max_element( nb_pts_.begin(), nb_pts_.end() );
+    min_pts_ = *std::min_element( nb_pts_.begin(), nb_pts_.end() );
+
+    // The first point of each partition within its band, in west to east and north to south order,
+    // is found by selection rather than by sorting all points of the band.
+    splitters_.resize( nb_partitions_ );
+    auto row_of = [&]( gidx_t index ) -> idx_t {
+        return std::upper_bound( row_begin_.begin() + 1, row_begin_.end(), index ) - row_begin_.begin() - 1;
+    };
+    auto x = [&]( idx_t i, idx_t j ) { return microdeg( grid_.x( i, j ) ); };
+
+    for ( idx_t b = 0; b < nb_bands; ++b ) {
+        const gidx_t b_begin = band_begin_[b];
+        const gidx_t b_end   = band_begin_[b + 1];
+        if ( b_end == b_begin ) {
+            for ( int q = band_partition_begin_[b]; q < band_partition_begin_[b + 1]; ++q ) {
+                splitters_[q] = Key{std::numeric_limits<int>::max(), std::numeric_limits<int>::min()};
+            }
+            continue;
+        }
+        std::vector<BandRow> rows;
+        for ( idx_t j = row_of( b_begin ); j <= row_of( b_end - 1 ); ++j ) {
+            idx_t i_begin = static_cast<idx_t>( std::max( b_begin, row_begin_[j] ) - row_begin_[j] );
+            idx_t i_end   = static_cast<idx_t>( std::min( b_end, row_begin_[j + 1] ) - row_begin_[j] );
+            if ( i_end > i_begin ) {
+                rows.emplace_back( BandRow{j, i_begin, i_end, y_[j]} );
+            }
+        }
+
+        // Index of the first point in a row with x >= X (x is increasing within a row)
+        auto lower_bound = [&]( const BandRow& row, long X ) {
+            idx_t lo = row.i_begin;
+            idx_t hi = row.i_end;
+            while ( lo < hi ) {
+                idx_t mid = lo + ( hi - lo ) / 2;
+                if ( x( mid, row.j ) < X ) {
+                    lo = mid + 1;
+                }
+                else {
+                    hi = mid;
+                }
+            }
+            return lo;
+        };
+        // Number of points in the band with x < X
+        auto count_less = [&]( long X ) {
+            gidx_t count = 0;
+            for ( const auto& row : rows ) {
+                count += lower_bound( row, X ) - row.i_begin;
+            }
+            return count;
+        };
+
+        long xmin = std::numeric_limits<int>::max();
+        long xmax = std::numeric_limits<int>::min();
+        for ( const auto& row : rows ) {
+            xmin = std::min<long>( xmin, x( row.i_begin, row.j ) );
+            xmax = std::max<long>( xmax, x( row.i_end - 1, row.j ) );
+        }
+
+        const int q_begin = band_partition_begin_[b];
+        const int q_end   = band_partition_begin_[b + 1];
+        atlas_omp_parallel_for( int q = q_begin; q < q_end; ++q ) {
+            const gidx_t k = partition_begin[q] - b_begin;
+            if ( k >= b_end - b_begin ) {
+                // empty partition
+                splitters_[q] = Key{std::numeric_limits<int>::max(), std::numeric_limits<int>::min()};
+                continue;
+            }
+            // Smallest X such that more than k points have x <= X
+            long lo = xmin;
+            long hi = xmax;
+            while ( lo < hi ) {
+                long mid = lo + ( hi - lo ) / 2;
+                if ( count_less( mid + 1 ) > k ) {
+                    hi = mid;
+                }
+                else {
+                    lo = mid + 1;
+                }
+            }
+            // Points with x == X are ordered north to south
+            std::vector<int> y;
+            for ( const auto& row : rows ) {
+                idx_t i = lower_bound( row, lo );
+                if ( i < row.i_end && x( i, row.j ) == lo ) {
+                    y.emplace_back( row.y );
+                }
+            }
+            std::sort( y.begin(), y.end(), std::greater<int>() );
+            const gidx_t rank = k - count_less( lo );
+            ATLAS_ASSERT( rank < static_cast<gidx_t>( y.size() ) );
+            splitters_[q] = Key{static_cast<int>( lo ), y[rank]};
+        }
+    }
+}
+
+size_t EqualRegionsDistribution::footprint() const {
+    return nb_pts_.size() * sizeof( nb_pts_[0] ) + row_begin_.size() * sizeof( row_begin_[0] ) +
+           y_.size() * sizeof( y_[0] ) + band_begin_.size() * sizeof( band_begin_[0] ) +
+           band_partition_begin_.size() * sizeof( band_partition_begin_[0] ) +
+           splitters_.size() * sizeof( splitters_[0] );
+}
+
+}  // namespace distribution
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
@@ -0,0 +1,77 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/distribution/DistributionFunction.h"
+#include "atlas/util/MicroDeg.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace distribution {
+
+/// @brief Distribution of a StructuredGrid following the EqualRegionsPartitioner, without a partition array
+///
+/// Each band of regions owns a contiguous range of global indices. Within a band, points are ordered from
+/// west to east and north to south, and each region owns a contiguous range in that order. The first point
+/// of each region is computed once, so that the partition of any point can be evaluated from its coordinates.
+/// Memory use is proportional to the number of rows and partitions, rather than to the grid size.
+class EqualRegionsDistribution : public DistributionFunctionT<EqualRegionsDistribution> {
+public:
+    /// Coordinates in microdegrees
+    struct Key {
+        int x;
+        int y;
+    };
+
+    /// West to east, then north to south
+    ATLAS_ALWAYS_INLINE static bool compare_WE_NS( const Key& a, const Key& b ) {
+        return a.x < b.x || ( a.x == b.x && a.y > b.y );
+    }
+
+public:
+    EqualRegionsDistribution( const Grid& grid, idx_t nb_partitions, const std::vector<int>& nb_regions_per_band );
+
+    ATLAS_ALWAYS_INLINE int function( gidx_t index ) const {
+        const auto band   = std::upper_bound( band_begin_.begin() + 1, band_begin_.end(), index ) - 1;
+        const idx_t b     = static_cast<idx_t>( band - band_begin_.begin() );
+        const int p_begin = band_partition_begin_[b];
+        const int p_end   = band_partition_begin_[b + 1];
+        if ( p_end - p_begin == 1 ) {
+            return p_begin;
+        }
+        const idx_t j = std::upper_bound( row_begin_.begin() + 1, row_begin_.end(), index ) - row_begin_.begin() - 1;
+        const idx_t i = static_cast<idx_t>( index - row_begin_[j] );
+        const Key key{util::microdeg( grid_.x( i, j ) ), y_[j]};
+        auto first = splitters_.begin() + p_begin + 1;
+        auto last  = splitters_.begin() + p_end;
+        return p_begin + static_cast<int>( std::upper_bound( first, last, key, compare_WE_NS ) - first );
+    }
+
+    size_t footprint() const override;
+
+private:
+    StructuredGrid grid_;
+    std::vector<gidx_t> row_begin_;          // global index of first point of each row, size ny+1
+    std::vector<int> y_;                     // y of each row, in microdegrees
+    std::vector<gidx_t> band_begin_;         // global index of first point of each band, size nb_bands+1
+    std::vector<int> band_partition_begin_;  // first partition of each band, size nb_bands+1
+    std::vector<Key> splitters_;             // first point of each partition
+};
+
+}  // namespace distribution
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
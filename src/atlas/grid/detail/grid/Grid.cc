@@ -139,6 +139,26 @@ void Grid::detachObserver( GridObserver& observer ) const {
                            grid_observers_.end() );
 }
 
+void Grid::xy_range( gidx_t begin, gidx_t end, double xy[] ) const {
+    ATLAS_ASSERT( 0 <= begin && begin <= end && end <= size() );
+    if ( begin == end ) {
+        return;
+    }
+    auto it = xy_begin();
+    *it += static_cast<size_t>( begin );
+    PointXY p;
+    for ( gidx_t n = begin; n < end; ++n ) {
+        it->next( p );
+        *( xy++ ) = p.x();
+        *( xy++ ) = p.y();
+    }
+}
+
+void Grid::lonlat_range( gidx_t begin, gidx_t end, double lonlat[] ) const {
+    xy_range( begin, end, lonlat );
+    projection_.xy2lonlat( lonlat, lonlat, static_cast<size_t>( end - begin ) );
+}
+
 Grid::Config Grid::meshgenerator() const {
     ATLAS_NOTIMPLEMENTED;
 }
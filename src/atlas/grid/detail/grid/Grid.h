@@ -124,6 +124,15 @@ public:  // methods
     virtual std::unique_ptr<IteratorLonLat> lonlat_begin() const = 0;
     virtual std::unique_ptr<IteratorLonLat> lonlat_end() const   = 0;
 
+    /// Fill xy[] with the interleaved (x,y) coordinates of the grid points with global index in [begin,end)
+    /// @note Separate blocks can be filled concurrently, e.g. from an OpenMP loop
+    virtual void xy_range( gidx_t begin, gidx_t end, double xy[] ) const;
+
+    /// Fill lonlat[] with the interleaved (lon,lat) coordinates of the grid points with global index in [begin,end)
+    /// @note Separate blocks can be filled concurrently, but projection calls may be serialised (e.g. PROJ).
+    ///       For large arrays prefer filling xy concurrently, followed by a single Projection::xy2lonlat call.
+    virtual void lonlat_range( gidx_t begin, gidx_t end, double lonlat[] ) const;
+
     void attachObserver( GridObserver& ) const;
     void detachObserver( GridObserver& ) const;
 
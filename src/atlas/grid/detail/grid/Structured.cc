@@ -650,6 +650,28 @@ std::string Structured::type() const {
     return static_type();
 }
 
+void Structured::xy_range( gidx_t begin, gidx_t end, double xy[] ) const {
+    ATLAS_ASSERT( 0 <= begin && begin <= end && end <= size() );
+    if ( begin == end ) {
+        return;
+    }
+    idx_t i, j;
+    index2ij( begin, i, j );
+    gidx_t n = begin;
+    while ( n < end ) {
+        const double xmin = xmin_[j];
+        const double dx   = dx_[j];
+        const double y    = y_[j];
+        const idx_t iend  = static_cast<idx_t>( std::min<gidx_t>( nx_[j], i + ( end - n ) ) );
+        for ( ; i < iend; ++i, ++n ) {
+            *( xy++ ) = xmin + static_cast<double>( i ) * dx;
+            *( xy++ ) = y;
+        }
+        i = 0;
+        ++j;
+    }
+}
+
 Grid::Config Structured::meshgenerator() const {
     return Config( "type", "structured" );
 }
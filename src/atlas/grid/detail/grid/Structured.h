@@ -350,6 +350,8 @@ public:
         return std::unique_ptr<Grid::IteratorLonLat>( new IteratorLonLat( *this, false ) );
     }
 
+    virtual void xy_range( gidx_t begin, gidx_t end, double xy[] ) const override;
+
     gidx_t index( idx_t i, idx_t j ) const { return jglooff_[j] + i; }
 
     void index2ij( gidx_t gidx, idx_t& i, idx_t& j ) const {
@@ -220,6 +220,15 @@ Grid::Spec Unstructured::spec() const {
     return *cached_spec_;
 }
 
+void Unstructured::xy_range( gidx_t begin, gidx_t end, double xy[] ) const {
+    ATLAS_ASSERT( 0 <= begin && begin <= end && end <= size() );
+    const std::vector<PointXY>& pts = *points_;
+    for ( gidx_t n = begin; n < end; ++n ) {
+        *( xy++ ) = pts[n].x();
+        *( xy++ ) = pts[n].y();
+    }
+}
+
 Grid::Config Unstructured::meshgenerator() const {
     return Config( "type", "delaunay" );
 }
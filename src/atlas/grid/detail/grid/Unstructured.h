@@ -187,6 +187,8 @@ public:  // methods
         return std::unique_ptr<Grid::IteratorLonLat>( new IteratorLonLat( *this, false ) );
     }
 
+    virtual void xy_range( gidx_t begin, gidx_t end, double xy[] ) const override;
+
     Config meshgenerator() const override;
     Config partitioner() const override;
 
@@ -0,0 +1,210 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "CostWeightedPartitioner.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "atlas/grid/Grid.h"
+#include "atlas/grid/Iterator.h"
+#include "atlas/grid/detail/partitioner/EqualRegionsPartitioner.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/MicroDeg.h"
+
+using atlas::util::microdeg;
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+namespace {
+
+/// Assign the points order[begin:end] to the partitions [p_begin, p_begin+nb_parts), so that every partition
+/// receives an equal share of the cost. Each point goes to the partition containing the midpoint of its
+/// interval of the cumulative cost, which keeps the partitions contiguous in the given order.
+void split_by_cost( const std::vector<idx_t>& order, size_t begin, size_t end, const std::vector<double>& cost,
+                    int p_begin, int nb_parts, int part[] ) {
+    double total = 0.;
+    for ( size_t k = begin; k < end; ++k ) {
+        total += cost[order[k]];
+    }
+    if ( total > 0. ) {
+        double cumulative = 0.;
+        for ( size_t k = begin; k < end; ++k ) {
+            const double w = cost[order[k]];
+            const int slot = static_cast<int>( ( cumulative + 0.5 * w ) / total * nb_parts );
+            part[order[k]] = p_begin + std::min( slot, nb_parts - 1 );
+            cumulative += w;
+        }
+    }
+    else {
+        // No cost information: balance the number of points
+        const size_t size = end - begin;
+        for ( size_t k = begin; k < end; ++k ) {
+            part[order[k]] = p_begin + static_cast<int>( ( ( k - begin ) * size_t( nb_parts ) ) / size );
+        }
+    }
+}
+
+}  // namespace
+
+CostWeightedPartitioner::CostWeightedPartitioner() : Partitioner() {}
+
+CostWeightedPartitioner::CostWeightedPartitioner( int N ) : Partitioner( N ) {}
+
+CostWeightedPartitioner::CostWeightedPartitioner( int N, const eckit::Parametrisation& config ) : Partitioner( N ) {
+    setup( config );
+    config.get( "weights", weights_ );
+}
+
+CostWeightedPartitioner::CostWeightedPartitioner( int N, const Cost& cost, const eckit::Parametrisation& config ) :
+    Partitioner( N ), cost_( cost ) {
+    setup( config );
+}
+
+CostWeightedPartitioner::CostWeightedPartitioner( const Distribution& previous,
+                                                  const std::vector<double>& partition_cost,
+                                                  const eckit::Parametrisation& config ) :
+    Partitioner( previous.nb_partitions() ) {
+    setup( config );
+    ATLAS_ASSERT( partition_cost.size() == size_t( previous.nb_partitions() ) );
+
+    // Assume uniform cost within each partition of the previous distribution
+    std::vector<double> point_cost( partition_cost.size(), 0. );
+    for ( size_t p = 0; p < point_cost.size(); ++p ) {
+        if ( previous.nb_pts()[p] > 0 ) {
+            point_cost[p] = partition_cost[p] / previous.nb_pts()[p];
+        }
+    }
+    cost_ = [previous, point_cost]( gidx_t n ) { return point_cost[previous.partition( n )]; };
+}
+
+void CostWeightedPartitioner::setup( const eckit::Parametrisation& config ) {
+    config.get( "layout", layout_ );
+    if ( layout_ != "equal_regions" && layout_ != "bands" ) {
+        throw_Exception( "CostWeightedPartitioner: layout \"" + layout_ + "\" not supported. "
+                         "Possible values are \"equal_regions\" and \"bands\"",
+                         Here() );
+    }
+}
+
+std::vector<double> CostWeightedPartitioner::gather_partition_cost( double cost ) {
+    const auto& comm = mpi::comm();
+    std::vector<double> partition_cost( comm.size() );
+    ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGather( cost, partition_cost.begin(), partition_cost.end() ); }
+    return partition_cost;
+}
+
+void CostWeightedPartitioner::partition( const Grid& grid, int part[] ) const {
+    ATLAS_TRACE( "CostWeightedPartitioner::partition" );
+
+    const idx_t size   = grid.size();
+    const int nb_parts = nb_partitions();
+    if ( nb_parts == 1 ) {
+        atlas_omp_parallel_for( idx_t n = 0; n < size; ++n ) { part[n] = 0; }
+        return;
+    }
+
+    std::vector<double> cost;
+    if ( not weights_.empty() ) {
+        ATLAS_ASSERT( weights_.size() == size_t( size ), "Configuration \"weights\" must match the grid size" );
+        cost = weights_;
+    }
+    else if ( cost_ ) {
+        cost.resize( size );
+        for ( idx_t n = 0; n < size; ++n ) {
+            cost[n] = cost_( n );
+        }
+    }
+    else {
+        cost.assign( size, 1. );
+    }
+    for ( idx_t n = 0; n < size; ++n ) {
+        if ( cost[n] < 0. ) {
+            throw_Exception( "CostWeightedPartitioner: cost must not be negative", Here() );
+        }
+    }
+
+    std::vector<idx_t> order( size );
+    std::iota( order.begin(), order.end(), 0 );
+
+    if ( layout_ == "bands" ) {
+        split_by_cost( order, 0, size, cost, 0, nb_parts, part );
+        return;
+    }
+
+    // layout "equal_regions"
+    ATLAS_ASSERT( grid.projection().units() == "degrees" );
+    EqualRegionsPartitioner regions( nb_parts );
+
+    std::vector<int> x( size );
+    std::vector<int> y( size );
+    {
+        std::vector<PointXY> points( size );
+        grid.xy().fill( 0, size, points.data() );
+        atlas_omp_parallel_for( idx_t n = 0; n < size; ++n ) {
+            x[n] = microdeg( points[n].x() );
+            y[n] = microdeg( points[n].y() );
+        }
+    }
+
+    // Sort from north to south and west to east, and split in bands of equal cost per region
+    ATLAS_TRACE_SCOPE( "sort north-south" ) {
+        omp::sort( order.begin(), order.end(), [&]( idx_t n1, idx_t n2 ) {
+            return y[n1] > y[n2] || ( y[n1] == y[n2] && x[n1] < x[n2] );
+        } );
+    }
+    split_by_cost( order, 0, size, cost, 0, nb_parts, part );
+
+    std::vector<int> band_of_partition;
+    std::vector<int> band_partition_begin;
+    band_of_partition.reserve( nb_parts );
+    for ( int b = 0, p = 0; b < regions.nb_bands(); ++b ) {
+        band_partition_begin.emplace_back( p );
+        for ( int r = 0; r < regions.nb_regions( b ); ++r, ++p ) {
+            band_of_partition.emplace_back( b );
+        }
+    }
+
+    // Within every band, sort from west to east and north to south, and split in regions of equal cost
+    size_t begin = 0;
+    for ( int b = 0; b < regions.nb_bands(); ++b ) {
+        size_t end = begin;
+        while ( end < order.size() && band_of_partition[part[order[end]]] == b ) {
+            ++end;
+        }
+        ATLAS_TRACE_SCOPE( "sort west-east" ) {
+            omp::sort( order.begin() + begin, order.begin() + end, [&]( idx_t n1, idx_t n2 ) {
+                return x[n1] < x[n2] || ( x[n1] == x[n2] && y[n1] > y[n2] );
+            } );
+        }
+        if ( end > begin ) {
+            split_by_cost( order, begin, end, cost, band_partition_begin[b], regions.nb_regions( b ), part );
+        }
+        begin = end;
+    }
+    ATLAS_ASSERT( begin == order.size() );
+}
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
+
+namespace {
+atlas::grid::detail::partitioner::PartitionerBuilder<atlas::grid::detail::partitioner::CostWeightedPartitioner>
+    __CostWeighted( atlas::grid::detail::partitioner::CostWeightedPartitioner::static_type() );
+}
@@ -0,0 +1,75 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "atlas/grid/Distribution.h"
+#include "atlas/grid/detail/partitioner/Partitioner.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+/// @brief Partitioner balancing the total cost of each partition rather than its number of points
+///
+/// The cost of each grid point is given either
+///  - as configuration "weights", a list with one value for every point of the grid, or
+///  - as a function of the global index, or
+///  - from measured costs of each partition of a previous distribution, assuming uniform cost within each
+///    partition. Iterating this re-partitioning with run-time timings converges to balanced partitions.
+///
+/// Configuration "layout" selects the shape of the partitions:
+///  - "equal_regions" (default): bands and sectors as in EqualRegionsPartitioner
+///  - "bands": contiguous ranges of global indices
+///
+/// The cost must be known for all grid points on every task, so that all tasks compute the same distribution.
+class CostWeightedPartitioner : public Partitioner {
+public:
+    using Cost = std::function<double( gidx_t )>;
+
+public:
+    CostWeightedPartitioner();
+    CostWeightedPartitioner( int N );
+    CostWeightedPartitioner( int N, const eckit::Parametrisation& config );
+    CostWeightedPartitioner( int N, const Cost& cost, const eckit::Parametrisation& config = util::NoConfig() );
+
+    /// Re-partition, given the measured cost of each partition of a previous distribution
+    CostWeightedPartitioner( const Distribution& previous, const std::vector<double>& partition_cost,
+                             const eckit::Parametrisation& config = util::NoConfig() );
+
+    /// Gather the measured cost of every task (e.g. a timing), as required for re-partitioning.
+    /// This is a collective operation.
+    static std::vector<double> gather_partition_cost( double cost );
+
+    using Partitioner::partition;
+    void partition( const Grid&, int part[] ) const override;
+
+    std::string type() const override { return static_type(); }
+    static std::string static_type() { return "cost_weighted"; }
+
+private:
+    void setup( const eckit::Parametrisation& config );
+
+private:
+    std::string layout_{"equal_regions"};
+    std::vector<double> weights_;
+    Cost cost_;
+};
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
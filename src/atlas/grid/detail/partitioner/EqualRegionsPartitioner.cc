@@ -19,6 +19,7 @@
 
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/distribution/EqualRegionsDistribution.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/sort.h"
@@ -60,7 +61,7 @@ range_t<Iterator, Sentinel> range( Iterator b, Sentinel e ) {
 template <typename Container, typename Int>
 range_t<typename Container::const_iterator, typename Container::const_iterator> subrange(
     const Container& c, std::initializer_list<Int>&& _range ) {
-    return range( c.begin() + _range.begin()[1], c.begin() + _range.begin()[2] );
+    return range( c.begin() + _range.begin()[0], c.begin() + _range.begin()[1] );
 }
 
 }  // namespace
@@ -585,10 +586,24 @@ void EqualRegionsPartitioner::partition( int nb_nodes, NodeInt nodes[], int part
     // ((double)CLOCKS_PER_SEC) << "s)" << std::endl;
 }
 
+Distribution EqualRegionsPartitioner::partition( const Grid& grid ) const {
+    if ( StructuredGrid( grid ) ) {
+        ATLAS_ASSERT( grid.projection().units() == "degrees" );
+        return Distribution{new distribution::EqualRegionsDistribution{grid, N_, sectors_}};
+    }
+    return Partitioner::partition( grid );
+}
+
 void EqualRegionsPartitioner::partition( const Grid& grid, int part[] ) const {
     if ( N_ == 1 ) {  // trivial solution, so much faster
         atlas_omp_parallel_for( idx_t j = 0; j < grid.size(); ++j ) { part[j] = 0; }
     }
+    else if ( StructuredGrid( grid ) ) {
+        ATLAS_TRACE( "EqualRegionsPartitioner::partition" );
+        ATLAS_ASSERT( grid.projection().units() == "degrees" );
+        distribution::EqualRegionsDistribution distribution{grid, N_, sectors_};
+        atlas_omp_parallel_for( gidx_t n = 0; n < grid.size(); ++n ) { part[n] = distribution.function( n ); }
+    }
     else {
         ATLAS_TRACE( "EqualRegionsPartitioner::partition" );
 
@@ -604,84 +619,11 @@ void EqualRegionsPartitioner::partition( const Grid& grid, int part[] ) const {
 
         /*
     Sort nodes from north to south, and west to east. Now we can easily split
-    the points in bands. Note, for StructuredGrid, this should not be necessary,
-    as it is
-    already by construction in this order, but then sorting is really fast
+    the points in bands. StructuredGrids come in this order by construction,
+    and are handled by EqualRegionsDistribution instead.
     */
 
-        if ( StructuredGrid( grid ) ) {
-            // The grid comes sorted from north to south and west to east by
-            // construction
-            // ATLAS_ASSERT to make sure.
-            StructuredGrid structured_grid( grid );
-            //ATLAS_ASSERT( structured_grid.y( 1 ) < structured_grid.y( 0 ) );
-            ATLAS_ASSERT( structured_grid.x( 1, 0 ) > structured_grid.x( 0, 0 ) );
-
-            ATLAS_TRACE( "Take shortcut" );
-
-
-            if ( atlas_omp_get_max_threads() > 1 ) {
-                atlas_omp_parallel {
-                    const idx_t num_threads = atlas_omp_get_num_threads();
-                    const idx_t thread_num  = atlas_omp_get_thread_num();
-                    const idx_t begin =
-                        static_cast<idx_t>( thread_num * size_t( structured_grid.size() ) / num_threads );
-                    const idx_t end =
-                        static_cast<idx_t>( ( thread_num + 1 ) * size_t( structured_grid.size() ) / num_threads );
-                    idx_t thread_j_begin = 0;
-                    std::vector<idx_t> thread_i_begin( structured_grid.ny() );
-                    std::vector<idx_t> thread_i_end( structured_grid.ny() );
-                    idx_t n = 0;
-                    for ( idx_t j = 0; j < structured_grid.ny(); ++j ) {
-                        if ( n + structured_grid.nx( j ) > begin ) {
-                            thread_j_begin    = j;
-                            thread_i_begin[j] = begin - n;
-                            break;
-                        }
-                        n += structured_grid.nx( j );
-                    }
-                    idx_t thread_j_end{thread_j_begin};
-                    for ( idx_t j = thread_j_begin; j < structured_grid.ny(); ++j ) {
-                        idx_t i_end = end - n;
-                        if ( j > thread_j_begin ) {
-                            thread_i_begin[j] = 0;
-                        }
-                        if ( i_end > structured_grid.nx( j ) ) {
-                            thread_i_end[j] = structured_grid.nx( j );
-                            n += structured_grid.nx( j );
-                        }
-                        else {
-                            thread_i_end[j] = i_end;
-                            thread_j_end    = j + 1;
-                            break;
-                        }
-                    }
-                    int nn = begin;
-                    for ( idx_t j = thread_j_begin; j < thread_j_end; ++j ) {
-                        int y = microdeg( structured_grid.y( j ) );
-                        for ( idx_t i = thread_i_begin[j]; i < thread_i_end[j]; ++i, ++nn ) {
-                            nodes[nn].x = microdeg( structured_grid.x( i, j ) );
-                            nodes[nn].y = y;
-                            nodes[nn].n = nn;
-                        }
-                    }
-                    ATLAS_ASSERT( nn == end );
-                }
-            }
-            else {
-                int n( 0 );
-                for ( idx_t j = 0; j < structured_grid.ny(); ++j ) {
-                    int y = microdeg( structured_grid.y( j ) );
-                    for ( idx_t i = 0; i < structured_grid.nx( j ); ++i, ++n ) {
-                        nodes[n].x = microdeg( structured_grid.x( i, j ) );
-                        nodes[n].y = y;
-                        nodes[n].n = n;
-                    }
-                }
-            }
-        }
-        else {
-            ATLAS_TRACE( "sort all" );
+        ATLAS_TRACE_SCOPE( "sort all" ) {
             std::vector<eckit::mpi::Request> requests;
 
             for ( int w = 0; w < nb_workers; ++w ) {
@@ -65,6 +65,7 @@
 
 #include <vector>
 
+#include "atlas/grid/Distribution.h"
 #include "atlas/grid/detail/partitioner/Partitioner.h"
 
 namespace atlas {
@@ -86,8 +87,11 @@ public:
     int nb_bands() const { return bands_.size(); }
     int nb_regions( int band ) const { return sectors_[band]; }
 
-    using Partitioner::partition;
-    virtual void partition( const Grid&, int part[] ) const;
+    /// For StructuredGrid, the returned distribution is functional (EqualRegionsDistribution),
+    /// avoiding a partition array of the global grid size.
+    Distribution partition( const Grid& ) const override;
+
+    void partition( const Grid&, int part[] ) const override;
 
     virtual std::string type() const { return "equal_regions"; }
 
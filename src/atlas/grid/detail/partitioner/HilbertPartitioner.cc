@@ -0,0 +1,222 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "HilbertPartitioner.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "atlas/domain/Domain.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/grid/Iterator.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Hilbert.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+namespace {
+
+struct HilbertPoint {
+    gidx_t key;  // position on the Hilbert curve
+    gidx_t n;    // global index in grid
+    bool operator<( const HilbertPoint& other ) const {
+        return key < other.key || ( key == other.key && n < other.n );
+    }
+};
+
+}  // namespace
+
+HilbertPartitioner::HilbertPartitioner() : Partitioner() {}
+
+HilbertPartitioner::HilbertPartitioner( int N ) : Partitioner( N ) {}
+
+HilbertPartitioner::HilbertPartitioner( int N, const eckit::Parametrisation& config ) : Partitioner( N ) {
+    config.get( "recursion", recursion_ );
+    config.get( "weights", weights_ );
+}
+
+void HilbertPartitioner::partition( const Grid& grid, int part[] ) const {
+    ATLAS_TRACE( "HilbertPartitioner::partition" );
+
+    const gidx_t size  = grid.size();
+    const int nb_parts = nb_partitions();
+    if ( nb_parts == 1 ) {
+        atlas_omp_parallel_for( gidx_t n = 0; n < size; ++n ) { part[n] = 0; }
+        return;
+    }
+    if ( not weights_.empty() ) {
+        ATLAS_ASSERT( weights_.size() == size_t( size ), "Configuration \"weights\" must match the grid size" );
+    }
+
+    const auto& comm     = mpi::comm();
+    const idx_t mpi_size = static_cast<idx_t>( comm.size() );
+    const idx_t mpi_rank = static_cast<idx_t>( comm.rank() );
+
+    // 1) Every task computes the Hilbert codes of its share of the grid points
+    const gidx_t begin = ( size * mpi_rank ) / mpi_size;
+    const gidx_t end   = ( size * ( mpi_rank + 1 ) ) / mpi_size;
+
+    std::vector<PointXY> points( end - begin );
+    ATLAS_TRACE_SCOPE( "create points" ) { grid.xy().fill( begin, end, points.data() ); }
+
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = -std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double ymax = -std::numeric_limits<double>::max();
+    for ( const auto& p : points ) {
+        xmin = std::min( xmin, p.x() );
+        xmax = std::max( xmax, p.x() );
+        ymin = std::min( ymin, p.y() );
+        ymax = std::max( ymax, p.y() );
+    }
+    ATLAS_TRACE_MPI( ALLREDUCE ) {
+        comm.allReduceInPlace( xmin, eckit::mpi::min() );
+        comm.allReduceInPlace( xmax, eckit::mpi::max() );
+        comm.allReduceInPlace( ymin, eckit::mpi::min() );
+        comm.allReduceInPlace( ymax, eckit::mpi::max() );
+    }
+    util::Hilbert hilbert{RectangularDomain( {xmin, xmax}, {ymin, ymax} ), recursion_};
+
+    std::vector<HilbertPoint> local( points.size() );
+    ATLAS_TRACE_SCOPE( "hilbert codes" ) {
+        atlas_omp_parallel_for( size_t j = 0; j < points.size(); ++j ) {
+            local[j] = HilbertPoint{hilbert( points[j] ), begin + gidx_t( j )};
+        }
+    }
+    points.clear();
+    points.shrink_to_fit();
+
+    // 2) Parallel sample sort along the curve
+    ATLAS_TRACE_SCOPE( "sort local" ) { omp::sort( local.begin(), local.end() ); }
+
+    std::vector<HilbertPoint> splitters;
+    {
+        const idx_t nb_samples = local.empty() ? 0 : std::min<idx_t>( mpi_size, 64 );
+        std::vector<gidx_t> samples;
+        samples.reserve( 2 * nb_samples );
+        for ( idx_t j = 0; j < nb_samples; ++j ) {
+            const auto& sample = local[( size_t( j ) * local.size() ) / size_t( nb_samples )];
+            samples.emplace_back( sample.key );
+            samples.emplace_back( sample.n );
+        }
+        eckit::mpi::Buffer<gidx_t> recv_samples( mpi_size );
+        ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( samples.begin(), samples.end(), recv_samples ); }
+        std::vector<HilbertPoint> all_samples;
+        all_samples.reserve( recv_samples.buffer.size() / 2 );
+        for ( size_t j = 0; j < recv_samples.buffer.size(); j += 2 ) {
+            all_samples.emplace_back( HilbertPoint{recv_samples.buffer[j], recv_samples.buffer[j + 1]} );
+        }
+        std::sort( all_samples.begin(), all_samples.end() );
+        if ( not all_samples.empty() ) {
+            for ( idx_t jpart = 1; jpart < mpi_size; ++jpart ) {
+                splitters.emplace_back( all_samples[( size_t( jpart ) * all_samples.size() ) / size_t( mpi_size )] );
+            }
+        }
+    }
+
+    std::vector<std::vector<gidx_t>> send( mpi_size );
+    std::vector<std::vector<gidx_t>> recv( mpi_size );
+    {
+        idx_t jpart = 0;
+        for ( const auto& p : local ) {
+            while ( jpart < static_cast<idx_t>( splitters.size() ) && not( p < splitters[jpart] ) ) {
+                ++jpart;
+            }
+            send[jpart].emplace_back( p.key );
+            send[jpart].emplace_back( p.n );
+        }
+    }
+    local.clear();
+    local.shrink_to_fit();
+    ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( send, recv ); }
+    send.clear();
+
+    std::vector<HilbertPoint> sorted;
+    for ( const auto& r : recv ) {
+        for ( size_t j = 0; j < r.size(); j += 2 ) {
+            sorted.emplace_back( HilbertPoint{r[j], r[j + 1]} );
+        }
+    }
+    recv.clear();
+    ATLAS_TRACE_SCOPE( "sort received" ) { omp::sort( sorted.begin(), sorted.end() ); }
+
+    // 3) Cut the curve in pieces of equal size or equal cost. Points sorted on this task follow the
+    //    points sorted on all previous tasks.
+    std::vector<int> sorted_part( sorted.size() );
+    if ( weights_.empty() ) {
+        std::vector<gidx_t> nb_sorted( mpi_size );
+        ATLAS_TRACE_MPI( ALLGATHER ) {
+            comm.allGather( static_cast<gidx_t>( sorted.size() ), nb_sorted.begin(), nb_sorted.end() );
+        }
+        gidx_t offset = 0;
+        for ( idx_t jpart = 0; jpart < mpi_rank; ++jpart ) {
+            offset += nb_sorted[jpart];
+        }
+        for ( size_t j = 0; j < sorted.size(); ++j ) {
+            sorted_part[j] = static_cast<int>( ( ( offset + gidx_t( j ) ) * nb_parts ) / size );
+        }
+    }
+    else {
+        double local_cost = 0.;
+        for ( const auto& p : sorted ) {
+            local_cost += weights_[p.n];
+        }
+        std::vector<double> cost( mpi_size );
+        ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGather( local_cost, cost.begin(), cost.end() ); }
+        double cumulative = 0.;
+        double total      = 0.;
+        for ( idx_t jpart = 0; jpart < mpi_size; ++jpart ) {
+            if ( jpart < mpi_rank ) {
+                cumulative += cost[jpart];
+            }
+            total += cost[jpart];
+        }
+        ATLAS_ASSERT( total > 0., "Sum of \"weights\" must be positive" );
+        for ( size_t j = 0; j < sorted.size(); ++j ) {
+            const double w = weights_[sorted[j].n];
+            const int slot = static_cast<int>( ( cumulative + 0.5 * w ) / total * nb_parts );
+            sorted_part[j] = std::min( slot, nb_parts - 1 );
+            cumulative += w;
+        }
+    }
+
+    // 4) Every task receives the partition of all points
+    std::vector<gidx_t> send_part;
+    send_part.reserve( 2 * sorted.size() );
+    for ( size_t j = 0; j < sorted.size(); ++j ) {
+        send_part.emplace_back( sorted[j].n );
+        send_part.emplace_back( sorted_part[j] );
+    }
+    sorted.clear();
+    sorted.shrink_to_fit();
+    eckit::mpi::Buffer<gidx_t> recv_part( mpi_size );
+    ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( send_part.begin(), send_part.end(), recv_part ); }
+    ATLAS_ASSERT( recv_part.buffer.size() == size_t( 2 * size ) );
+    for ( size_t j = 0; j < recv_part.buffer.size(); j += 2 ) {
+        part[recv_part.buffer[j]] = static_cast<int>( recv_part.buffer[j + 1] );
+    }
+}
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
+
+namespace {
+atlas::grid::detail::partitioner::PartitionerBuilder<atlas::grid::detail::partitioner::HilbertPartitioner> __Hilbert(
+    atlas::grid::detail::partitioner::HilbertPartitioner::static_type() );
+}
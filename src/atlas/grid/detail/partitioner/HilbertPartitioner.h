@@ -0,0 +1,54 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/grid/detail/partitioner/Partitioner.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+/// @brief Partitioner cutting a Hilbert space-filling curve through all grid points in equal pieces
+///
+/// Works for any grid, including UnstructuredGrid and Healpix grids, and gives compact partitions.
+/// The points are sorted along the curve with a parallel sample sort, so that each MPI task only computes
+/// and sorts the Hilbert codes of a 1/nb_tasks share of the grid.
+///
+/// The optional configuration can contain:
+///
+///     - "recursion" : <int>  (default=30)  // Recursion of hilbert space-filling curve
+///     - "weights"   : <list> (optional)    // Cost of every grid point; pieces then have equal cost
+///                                          // rather than an equal number of points
+class HilbertPartitioner : public Partitioner {
+public:
+    HilbertPartitioner();
+    HilbertPartitioner( int N );
+    HilbertPartitioner( int N, const eckit::Parametrisation& config );
+
+    using Partitioner::partition;
+    void partition( const Grid&, int part[] ) const override;
+
+    std::string type() const override { return static_type(); }
+    static std::string static_type() { return "hilbert"; }
+
+private:
+    idx_t recursion_{30};
+    std::vector<double> weights_;
+};
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
@@ -58,15 +58,15 @@ void MatchingFunctionSpacePartitionerLonLatPolygon::partition( const Grid& grid,
             for( size_t chunk=0; chunk < chunks; ++chunk) {
                 const size_t begin = chunk * size_t( grid.size() ) / chunks;
                 const size_t end   = ( chunk + 1 ) * size_t( grid.size() ) / chunks;
-                auto it            = grid.xy().begin() + chunk * grid.size() / chunks;
+                std::vector<PointXY> points( end - begin );
+                grid.xy().fill( begin, end, points.data() );
                 for ( size_t n = begin; n < end; ++n ) {
-                    if ( poly.contains( *it ) ) {
+                    if ( poly.contains( points[n - begin] ) ) {
                         part[n] = rank;
                     }
                     else {
                         part[n] = -1;
                     }
-                    ++it;
                 }
             }
         }
@@ -54,9 +54,11 @@ void MatchingMeshPartitionerLonLatPolygon::partition( const Grid& grid, int part
 
     {
         eckit::ProgressTimer timer( "Partitioning", grid.size(), "point", double( 10 ), atlas::Log::trace() );
-        size_t i = 0;
+        std::vector<PointLonLat> points( grid.size() );
+        grid.lonlat().fill( 0, grid.size(), points.data() );
 
-        for ( PointLonLat P : grid.lonlat() ) {
+        size_t i = 0;
+        for ( PointLonLat P : points ) {
             ++timer;
             projection.lonlat2xy( P );
             const bool atThePole = ( includesNorthPole && P[LAT] >= poly.coordinatesMax()[LAT] ) ||
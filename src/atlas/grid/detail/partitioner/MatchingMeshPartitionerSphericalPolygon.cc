@@ -60,9 +60,11 @@ void MatchingMeshPartitionerSphericalPolygon::partition( const Grid& grid, int p
 
     {
         eckit::ProgressTimer timer( "Partitioning", grid.size(), "point", double( 10 ), atlas::Log::trace() );
-        size_t i = 0;
+        std::vector<PointLonLat> points( grid.size() );
+        grid.lonlat().fill( 0, grid.size(), points.data() );
 
-        for ( const PointLonLat& P : grid.lonlat() ) {
+        size_t i = 0;
+        for ( const PointLonLat& P : points ) {
             ++timer;
             partitioning[i++] = at_the_pole( P ) || poly.contains( P ) ? mpi_rank : -1;
         }
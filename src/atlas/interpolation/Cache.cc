@@ -0,0 +1,263 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/interpolation/Cache.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "eckit/log/Bytes.h"
+
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/MappedFile.h"
+
+namespace atlas {
+namespace interpolation {
+
+namespace {
+
+using Matrix = MatrixCacheEntry::Matrix;
+using Layout = Matrix::Layout;
+using Shape  = Matrix::Shape;
+using util::align;
+
+// On-disk layout: header, followed by the values, the outer (row) indices and the inner (column) indices.
+// All sections start at multiples of 8 bytes so that the memory-mapped arrays are properly aligned.
+struct MatrixFileHeader {
+    char magic[8];
+    std::uint64_t version;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t nonzeros;
+    std::uint64_t sizeof_scalar;
+    std::uint64_t sizeof_index;
+};
+
+constexpr char matrix_file_magic[8]      = {'A', 'T', 'L', 'A', 'S', 'S', 'P', 'M'};
+constexpr std::uint64_t matrix_file_version = 1;
+
+size_t sizeof_index() {
+    return sizeof( *Layout().inner_ );
+}
+
+size_t sizeof_outer() {
+    return sizeof( *Layout().outer_ );
+}
+
+// Allocator which does not allocate, but points the matrix to externally owned memory.
+// The owner is kept alive for as long as the matrix exists.
+class MatrixViewAllocator : public Matrix::Allocator {
+public:
+    MatrixViewAllocator( const std::shared_ptr<const void>& owner, const Layout& layout, const Shape& shape ) :
+        owner_( owner ), layout_( layout ), shape_( shape ) {}
+
+    virtual Layout allocate( Shape& shape ) override {
+        shape = shape_;
+        return layout_;
+    }
+
+    virtual void deallocate( Layout, Shape ) override {}
+
+    virtual bool inSharedMemory() const override { return false; }
+
+    virtual void print( std::ostream& out ) const override { out << "MatrixViewAllocator[]"; }
+
+private:
+    std::shared_ptr<const void> owner_;
+    Layout layout_;
+    Shape shape_;
+};
+
+Layout layout( const Matrix& m ) {
+    Layout layout;
+    layout.data_  = const_cast<decltype( layout.data_ )>( m.data() );
+    layout.outer_ = const_cast<decltype( layout.outer_ )>( m.outer() );
+    layout.inner_ = const_cast<decltype( layout.inner_ )>( m.inner() );
+    return layout;
+}
+
+Shape shape( const Matrix& m ) {
+    Shape shape;
+    shape.size_ = m.nonZeros();
+    shape.rows_ = m.rows();
+    shape.cols_ = m.cols();
+    return shape;
+}
+
+class MatrixCacheMemoryEntry final : public MatrixCacheEntry {
+public:
+    MatrixCacheMemoryEntry( Matrix& m ) { matrix_.swap( m ); }
+    virtual const Matrix& matrix() const override { return matrix_; }
+
+private:
+    Matrix matrix_;
+};
+
+class MatrixCacheFileEntry final : public MatrixCacheEntry {
+public:
+    MatrixCacheFileEntry( const eckit::PathName& path ) {
+        ATLAS_TRACE( "MatrixCacheFileEntry::map" );
+        Log::debug() << "Memory-mapping interpolation matrix cache from file " << path << std::endl;
+
+        // Private writable mapping: pages are shared with the page cache until written to, which never happens
+        file_.reset( new util::MappedFile( path ) );
+        if ( file_->size() < sizeof( MatrixFileHeader ) ) {
+            throw_Exception( "Interpolation matrix cache file " + path.asString() + " is corrupt", Here() );
+        }
+
+        const auto& header = *reinterpret_cast<const MatrixFileHeader*>( file_->data() );
+        if ( std::memcmp( header.magic, matrix_file_magic, sizeof( matrix_file_magic ) ) != 0 ||
+             header.version != matrix_file_version || header.sizeof_scalar != sizeof( eckit::linalg::Scalar ) ||
+             header.sizeof_index != sizeof_index() ) {
+            throw_Exception( "Interpolation matrix cache file " + path.asString() + " is not compatible", Here() );
+        }
+
+        Shape s;
+        s.size_ = header.nonzeros;
+        s.rows_ = header.rows;
+        s.cols_ = header.cols;
+
+        char* begin   = file_->data();
+        size_t offset = align( sizeof( MatrixFileHeader ) );
+        Layout l;
+        l.data_ = reinterpret_cast<decltype( l.data_ )>( begin + offset );
+        offset += align( s.size_ * sizeof( *l.data_ ) );
+        l.outer_ = reinterpret_cast<decltype( l.outer_ )>( begin + offset );
+        offset += align( ( s.rows_ + 1 ) * sizeof_outer() );
+        l.inner_ = reinterpret_cast<decltype( l.inner_ )>( begin + offset );
+        offset += align( s.size_ * sizeof_index() );
+        if ( offset != file_->size() ) {
+            throw_Exception( "Interpolation matrix cache file " + path.asString() + " is corrupt", Here() );
+        }
+
+        // The mapping is owned by this entry, which outlives matrix_
+        Matrix m( new MatrixViewAllocator( nullptr, l, s ) );
+        matrix_.swap( m );
+
+        Log::debug() << "    size: " << eckit::Bytes( file_->size() ) << std::endl;
+    }
+
+    virtual ~MatrixCacheFileEntry() override {
+        Matrix empty;
+        matrix_.swap( empty );
+    }
+
+    virtual const Matrix& matrix() const override { return matrix_; }
+
+private:
+    std::unique_ptr<util::MappedFile> file_;
+    Matrix matrix_;
+};
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+InterpolationCacheEntry::~InterpolationCacheEntry() = default;
+
+MatrixCacheEntry::~MatrixCacheEntry() = default;
+
+//-----------------------------------------------------------------------------
+
+Cache::Cache( const Cache& other ) = default;
+
+Cache::Cache( const std::shared_ptr<InterpolationCacheEntry>& cache ) {
+    cache_[cache->type()] = cache;
+}
+
+Cache::Cache( const Cache& other, const std::string& filter ) {
+    auto entry = other.cache_.find( filter );
+    if ( entry != other.cache_.end() ) {
+        cache_[filter] = entry->second;
+    }
+}
+
+Cache::~Cache() = default;
+
+size_t Cache::footprint() const {
+    size_t footprint{0};
+    for ( const auto& entry : cache_ ) {
+        footprint += entry.second->footprint();
+    }
+    return footprint;
+}
+
+const InterpolationCacheEntry* Cache::get( const std::string& type ) const {
+    auto entry = cache_.find( type );
+    if ( entry != cache_.end() ) {
+        return entry->second.get();
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const InterpolationCacheEntry> Cache::share( const std::string& type ) const {
+    auto entry = cache_.find( type );
+    if ( entry != cache_.end() ) {
+        return entry->second;
+    }
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+MatrixCache::MatrixCache( const Cache& c ) :
+    Cache( c, MatrixCacheEntry::static_type() ),
+    matrix_{dynamic_cast<const MatrixCacheEntry*>( get( MatrixCacheEntry::static_type() ) )} {}
+
+MatrixCache::MatrixCache( Matrix&& m ) : Cache( std::make_shared<MatrixCacheMemoryEntry>( m ) ) {
+    matrix_ = dynamic_cast<const MatrixCacheEntry*>( get( MatrixCacheEntry::static_type() ) );
+}
+
+MatrixCache::MatrixCache( const eckit::PathName& path ) :
+    Cache( std::shared_ptr<InterpolationCacheEntry>( new MatrixCacheFileEntry( path ) ) ) {
+    matrix_ = dynamic_cast<const MatrixCacheEntry*>( get( MatrixCacheEntry::static_type() ) );
+}
+
+const MatrixCache::Matrix& MatrixCache::matrix() const {
+    ATLAS_ASSERT( matrix_ != nullptr );
+    return matrix_->matrix();
+}
+
+void MatrixCache::view( Matrix& m ) const {
+    const Matrix& cached = matrix();
+    Matrix v( new MatrixViewAllocator( share( MatrixCacheEntry::static_type() ), layout( cached ), shape( cached ) ) );
+    m.swap( v );
+}
+
+void MatrixCache::save( const eckit::PathName& path ) const {
+    ATLAS_TRACE( "MatrixCache::save" );
+    const Matrix& m = matrix();
+
+    MatrixFileHeader header;
+    std::memcpy( header.magic, matrix_file_magic, sizeof( matrix_file_magic ) );
+    header.version       = matrix_file_version;
+    header.rows          = m.rows();
+    header.cols          = m.cols();
+    header.nonzeros      = m.nonZeros();
+    header.sizeof_scalar = sizeof( eckit::linalg::Scalar );
+    header.sizeof_index  = sizeof_index();
+
+    util::MappedFileWriter file( path );
+    file.write( &header, sizeof( header ) );
+    file.write( m.data(), m.nonZeros() * sizeof( *m.data() ) );
+    file.write( m.outer(), ( m.rows() + 1 ) * sizeof_outer() );
+    file.write( m.inner(), m.nonZeros() * sizeof_index() );
+    file.close();
+    Log::debug() << "Written interpolation matrix cache file " << path << " (" << eckit::Bytes( path.size() ) << ")"
+                 << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace interpolation
+}  // namespace atlas
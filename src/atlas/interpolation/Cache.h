@@ -0,0 +1,96 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "eckit/filesystem/PathName.h"
+#include "eckit/linalg/SparseMatrix.h"
+
+//-----------------------------------------------------------------------------
+
+namespace atlas {
+namespace interpolation {
+
+//-----------------------------------------------------------------------------
+
+class InterpolationCacheEntry {
+public:
+    virtual ~InterpolationCacheEntry();
+    virtual size_t footprint() const = 0;
+    virtual std::string type() const = 0;
+};
+
+//-----------------------------------------------------------------------------
+
+class Cache {
+public:
+    Cache() = default;
+    Cache( const Cache& other );
+    operator bool() const { return not cache_.empty(); }
+    virtual ~Cache();
+    size_t footprint() const;
+
+protected:
+    Cache( const std::shared_ptr<InterpolationCacheEntry>& cache );
+    Cache( const Cache& other, const std::string& filter );
+
+    const InterpolationCacheEntry* get( const std::string& type ) const;
+    std::shared_ptr<const InterpolationCacheEntry> share( const std::string& type ) const;
+
+private:
+    std::map<std::string, std::shared_ptr<InterpolationCacheEntry>> cache_;
+};
+
+//-----------------------------------------------------------------------------
+
+class MatrixCacheEntry : public InterpolationCacheEntry {
+public:
+    using Matrix = eckit::linalg::SparseMatrix;
+    virtual ~MatrixCacheEntry() override;
+    virtual const Matrix& matrix() const = 0;
+    virtual size_t footprint() const override { return matrix().footprint(); }
+    virtual std::string type() const override { return static_type(); }
+    static std::string static_type() { return "Matrix"; }
+};
+
+//-----------------------------------------------------------------------------
+
+/// Cache of an interpolation matrix, either held in memory or memory-mapped from a file
+/// previously written with MatrixCache::save().
+/// The matrix is shared, not copied, by all interpolations set up from this cache.
+class MatrixCache final : public Cache {
+public:
+    using Matrix = MatrixCacheEntry::Matrix;
+
+    MatrixCache() = default;
+    MatrixCache( const Cache& c );
+    MatrixCache( Matrix&& m );
+    MatrixCache( const eckit::PathName& path );
+
+    const Matrix& matrix() const;
+
+    /// Make given matrix a read-only view of the cached matrix, which keeps the cache entry alive
+    void view( Matrix& ) const;
+
+    /// Write matrix to file, in a format which can be memory-mapped by MatrixCache( path )
+    void save( const eckit::PathName& path ) const;
+
+private:
+    const MatrixCacheEntry* matrix_{nullptr};
+};
+
+//-----------------------------------------------------------------------------
+
+}  // namespace interpolation
+}  // namespace atlas
@@ -9,24 +9,123 @@
  */
 
 #include <fstream>
+#include <sstream>
+#include <vector>
 
+#include "eckit/config/Configuration.h"
+#include "eckit/exception/Exceptions.h"
+#include "eckit/filesystem/PathName.h"
+#include "eckit/log/JSON.h"
+#include "eckit/utils/MD5.h"
+
+#include "atlas/array/ArrayView.h"
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/grid/Grid.h"
 #include "atlas/interpolation/Interpolation.h"
 #include "atlas/interpolation/method/MethodFactory.h"
+#include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
 
 namespace atlas {
 
-Interpolation::Interpolation( const Config& config, const FunctionSpace& source, const FunctionSpace& target ) :
-    Handle( [&]() -> Implementation* {
-        std::string type;
-        ATLAS_ASSERT( config.get( "type", type ) );
-        Implementation* impl = interpolation::MethodFactory::build( type, config );
+namespace {
+
+void hash( eckit::Hash& h, const Grid& grid ) {
+    grid.hash( h );
+    // Meshes or partitions generated from the grid depend on the number of tasks
+    h.add( static_cast<long>( mpi::size() ) );
+}
+
+void hash( eckit::Hash& h, const FunctionSpace& fs ) {
+    // The coordinates of all points (including halo) uniquely define this task's part of the function space
+    h << fs.type();
+    auto lonlat = array::make_view<double, 2>( fs.lonlat() );
+    std::vector<double> points;
+    points.reserve( 2 * lonlat.shape( 0 ) );
+    for ( idx_t n = 0; n < lonlat.shape( 0 ); ++n ) {
+        points.push_back( lonlat( n, 0 ) );
+        points.push_back( lonlat( n, 1 ) );
+    }
+    h.add( points.data(), static_cast<long>( points.size() * sizeof( double ) ) );
+}
+
+bool hash( eckit::Hash& h, const Interpolation::Config& config ) {
+    auto configuration = dynamic_cast<const eckit::Configuration*>( &config );
+    if ( configuration == nullptr ) {
+        return false;
+    }
+    std::stringstream s;
+    eckit::JSON json( s );
+    json.precision( 17 );
+    json << *configuration;
+    h << s.str();
+    return true;
+}
+
+/// Setup the interpolation method, using the "cache_directory" configuration option when no cache is given.
+/// Interpolation matrices are then read from (and if not present or not readable written to) a file in that directory,
+/// unique for the method configuration and for this task's part of the source and target.
+template <typename Source, typename Target>
+Interpolation::Implementation* build( const Interpolation::Config& config, const Source& source, const Target& target,
+                                      const interpolation::Cache& cache ) {
+    std::string type;
+    ATLAS_ASSERT( config.get( "type", type ) );
+    Interpolation::Implementation* impl = interpolation::MethodFactory::build( type, config );
+
+    std::string directory;
+    if ( cache || not config.get( "cache_directory", directory ) ) {
+        impl->setup( source, target, cache );
+        return impl;
+    }
+
+    eckit::MD5 h;
+    if ( not hash( h, config ) ) {
+        Log::warning() << "Interpolation configuration cannot be hashed: \"cache_directory\" is ignored" << std::endl;
         impl->setup( source, target );
         return impl;
-    }() ) {
+    }
+    hash( h, source );
+    hash( h, target );
+
+    eckit::PathName path( directory + "/" + type + "-" + h.digest() + "-" + std::to_string( mpi::rank() ) + ".matrix" );
+    interpolation::MatrixCache cached;
+    if ( path.exists() ) {
+        try {
+            cached = interpolation::MatrixCache( path );
+        }
+        catch ( const eckit::Exception& e ) {
+            // e.g. a file that is truncated or written by an incompatible version: it is recomputed and overwritten
+            Log::warning() << "Ignoring interpolation matrix cache file " << path << ": " << e.what() << std::endl;
+        }
+    }
+    if ( cached ) {
+        impl->setup( source, target, cached );
+    }
+    else {
+        impl->setup( source, target );
+        interpolation::MatrixCache created( impl->createCache() );
+        if ( created ) {
+            eckit::PathName( directory ).mkdir();
+            created.save( path );
+        }
+    }
+    return impl;
+}
+
+}  // namespace
+
+Interpolation::Interpolation( const Config& config, const FunctionSpace& source, const FunctionSpace& target ) :
+    Interpolation( config, source, target, interpolation::Cache() ) {}
+
+Interpolation::Interpolation( const Config& config, const Grid& source, const Grid& target ) :
+    Interpolation( config, source, target, interpolation::Cache() ) {}
+
+Interpolation::Interpolation( const Config& config, const FunctionSpace& source, const FunctionSpace& target,
+                              const interpolation::Cache& cache ) :
+    Handle( build( config, source, target, cache ) ) {
     std::string path;
     if ( config.get( "output", path ) ) {
         std::ofstream file( path );
@@ -34,14 +133,9 @@ Interpolation::Interpolation( const Config& config, const FunctionSpace& source,
     }
 }
 
-Interpolation::Interpolation( const Config& config, const Grid& source, const Grid& target ) :
-    Handle( [&]() -> Implementation* {
-        std::string type;
-        ATLAS_ASSERT( config.get( "type", type ) );
-        Implementation* impl = interpolation::MethodFactory::build( type, config );
-        impl->setup( source, target );
-        return impl;
-    }() ) {
+Interpolation::Interpolation( const Config& config, const Grid& source, const Grid& target,
+                              const interpolation::Cache& cache ) :
+    Handle( build( config, source, target, cache ) ) {
     std::string path;
     if ( config.get( "output", path ) ) {
         std::ofstream file( path );
@@ -92,6 +186,10 @@ void Interpolation::print( std::ostream& out ) const {
     get()->print( out );
 }
 
+interpolation::Cache Interpolation::createCache() const {
+    return get()->createCache();
+}
+
 const FunctionSpace& Interpolation::source() const {
     return get()->source();
 }
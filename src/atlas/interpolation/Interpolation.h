@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "atlas/interpolation/Cache.h"
 #include "atlas/interpolation/method/Method.h"
 #include "atlas/library/config.h"
 #include "atlas/util/ObjectHandle.h"
@@ -49,12 +50,21 @@ public:
     // Setup Interpolation from source grid to target grid
     Interpolation( const Config&, const Grid& source, const Grid& target ) noexcept( false );
 
+    // Setup Interpolation from source to target function space, taking the interpolation matrix from cache if possible
+    Interpolation( const Config&, const FunctionSpace& source, const FunctionSpace& target,
+                   const interpolation::Cache& ) noexcept( false );
+
+    // Setup Interpolation from source grid to target grid, taking the interpolation matrix from cache if possible
+    Interpolation( const Config&, const Grid& source, const Grid& target, const interpolation::Cache& ) noexcept( false );
+
     void execute( const FieldSet& source, FieldSet& target ) const;
 
     void execute( const Field& source, Field& target ) const;
 
     void print( std::ostream& out ) const;
 
+    interpolation::Cache createCache() const;
+
     const FunctionSpace& source() const;
     const FunctionSpace& target() const;
 };
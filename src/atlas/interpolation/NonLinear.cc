@@ -52,5 +52,11 @@ bool NonLinear::execute( NonLinear::Matrix& W, const Field& f ) const {
 }
 
 
+bool NonLinear::execute( const NonLinear::Matrix& W, const Field& f, NonLinear::Corrections& corrections ) const {
+    ATLAS_ASSERT_MSG( operator bool(), "NonLinear: ObjectHandle not setup" );
+    return get()->execute( W, f, corrections );
+}
+
+
 }  // namespace interpolation
 }  // namespace atlas
@@ -37,7 +37,8 @@ namespace interpolation {
 struct NonLinear : DOXYGEN_HIDE( public util::ObjectHandle<nonlinear::NonLinear> ) {
     using Spec   = util::Config;
     using Config = nonlinear::NonLinear::Config;
-    using Matrix = nonlinear::NonLinear::Matrix;
+    using Matrix      = nonlinear::NonLinear::Matrix;
+    using Corrections = nonlinear::NonLinear::Corrections;
 
     /**
      * @brief ctor
@@ -67,6 +68,15 @@ struct NonLinear : DOXYGEN_HIDE( public util::ObjectHandle<nonlinear::NonLinear>
      * @return if W was modified
      */
     bool execute( Matrix& W, const Field& f ) const;
+
+    /**
+     * @brief Compute non-linear corrections to interpolation matrix, leaving it unmodified
+     * @param [in] W interpolation matrix
+     * @param [in] f field
+     * @param [out] corrections rows replacing rows of W
+     * @return if any row of W needs correcting
+     */
+    bool execute( const Matrix& W, const Field& f, Corrections& corrections ) const;
 };
 
 
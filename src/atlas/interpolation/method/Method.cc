@@ -21,6 +21,7 @@
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
 #include "atlas/field/MissingValue.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/runtime/Exception.h"
@@ -151,6 +152,134 @@ void Method::interpolate_field_rank3( const Field& src, Field& tgt, const Matrix
     }
 }
 
+template <typename Value>
+void Method::interpolate_fields( const FieldSet& src, FieldSet& tgt, const std::vector<idx_t>& fields,
+                                 const Matrix& W ) const {
+    if ( fields.empty() ) {
+        return;
+    }
+
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    idx_t rows        = static_cast<idx_t>( W.rows() );
+
+    // Each field is seen as a (points, var_size) matrix, with all levels and variables contiguous per point
+    struct FusedField {
+        const Value* src;
+        Value* tgt;
+        idx_t var_size;
+        idx_t src_stride;
+        idx_t tgt_stride;
+    };
+    std::vector<FusedField> fused;
+    fused.reserve( fields.size() );
+    for ( idx_t i : fields ) {
+        check_compatibility( src[i], tgt[i], W );
+        idx_t var_size = 1;
+        for ( idx_t d = 1; d < src[i].rank(); ++d ) {
+            var_size *= src[i].shape( d );
+        }
+        fused.push_back( FusedField{src[i].array().data<Value>(), tgt[i].array().data<Value>(), var_size,
+                                    src[i].stride( 0 ), tgt[i].stride( 0 )} );
+    }
+    const idx_t nb_fields = static_cast<idx_t>( fused.size() );
+
+    // One pass over the matrix: the weights of each row are read once and applied to all fields
+    atlas_omp_parallel_for( idx_t r = 0; r < rows; ++r ) {
+        for ( idx_t f = 0; f < nb_fields; ++f ) {
+            Value* t = fused[f].tgt + r * fused[f].tgt_stride;
+            for ( idx_t k = 0; k < fused[f].var_size; ++k ) {
+                t[k] = 0.;
+            }
+        }
+        for ( idx_t c = outer[r]; c < outer[r + 1]; ++c ) {
+            idx_t n = index[c];
+            Value w = static_cast<Value>( weight[c] );
+            for ( idx_t f = 0; f < nb_fields; ++f ) {
+                const Value* s = fused[f].src + n * fused[f].src_stride;
+                Value* t       = fused[f].tgt + r * fused[f].tgt_stride;
+                for ( idx_t k = 0; k < fused[f].var_size; ++k ) {
+                    t[k] += w * s[k];
+                }
+            }
+        }
+    }
+}
+
+template <typename Value>
+void Method::interpolate_field_corrections( const Field& src, Field& tgt,
+                                            const NonLinear::Corrections& corrections ) const {
+    const auto& rows   = corrections.rows;
+    const auto& outer  = corrections.outer;
+    const auto& index  = corrections.inner;
+    const auto& weight = corrections.data;
+    idx_t nb_rows      = static_cast<idx_t>( rows.size() );
+
+    if ( src.rank() == 1 ) {
+        auto v_src = array::make_view<Value, 1>( src );
+        auto v_tgt = array::make_view<Value, 1>( tgt );
+
+        atlas_omp_parallel_for( idx_t j = 0; j < nb_rows; ++j ) {
+            idx_t r    = static_cast<idx_t>( rows[j] );
+            v_tgt( r ) = 0.;
+            for ( auto c = outer[j]; c < outer[j + 1]; ++c ) {
+                idx_t n = static_cast<idx_t>( index[c] );
+                Value w = static_cast<Value>( weight[c] );
+                v_tgt( r ) += w * v_src( n );
+            }
+        }
+    }
+    else if ( src.rank() == 2 ) {
+        auto v_src = array::make_view<Value, 2>( src );
+        auto v_tgt = array::make_view<Value, 2>( tgt );
+
+        idx_t Nk = src.shape( 1 );
+
+        atlas_omp_parallel_for( idx_t j = 0; j < nb_rows; ++j ) {
+            idx_t r = static_cast<idx_t>( rows[j] );
+            for ( idx_t k = 0; k < Nk; ++k ) {
+                v_tgt( r, k ) = 0.;
+            }
+            for ( auto c = outer[j]; c < outer[j + 1]; ++c ) {
+                idx_t n = static_cast<idx_t>( index[c] );
+                Value w = static_cast<Value>( weight[c] );
+                for ( idx_t k = 0; k < Nk; ++k ) {
+                    v_tgt( r, k ) += w * v_src( n, k );
+                }
+            }
+        }
+    }
+    else if ( src.rank() == 3 ) {
+        auto v_src = array::make_view<Value, 3>( src );
+        auto v_tgt = array::make_view<Value, 3>( tgt );
+
+        idx_t Nk = src.shape( 1 );
+        idx_t Nl = src.shape( 2 );
+
+        atlas_omp_parallel_for( idx_t j = 0; j < nb_rows; ++j ) {
+            idx_t r = static_cast<idx_t>( rows[j] );
+            for ( idx_t k = 0; k < Nk; ++k ) {
+                for ( idx_t l = 0; l < Nl; ++l ) {
+                    v_tgt( r, k, l ) = 0.;
+                }
+            }
+            for ( auto c = outer[j]; c < outer[j + 1]; ++c ) {
+                idx_t n = static_cast<idx_t>( index[c] );
+                Value w = static_cast<Value>( weight[c] );
+                for ( idx_t k = 0; k < Nk; ++k ) {
+                    for ( idx_t l = 0; l < Nl; ++l ) {
+                        v_tgt( r, k, l ) += w * v_src( n, k, l );
+                    }
+                }
+            }
+        }
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;
+    }
+}
+
 Method::Method( const Method::Config& config ) {
     std::string spmv = "";
     config.get( "spmv", spmv );
@@ -182,6 +311,16 @@ void Method::setup( const FunctionSpace& source, const FieldSet& target ) {
     this->do_setup( source, target );
 }
 
+void Method::setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& cache ) {
+    ATLAS_TRACE( "atlas::interpolation::method::Method::setup(FunctionSpace, FunctionSpace, Cache)" );
+    this->do_setup( source, target, cache );
+}
+
+void Method::setup( const Grid& source, const Grid& target, const Cache& cache ) {
+    ATLAS_TRACE( "atlas::interpolation::method::Method::setup(Grid, Grid, Cache)" );
+    this->do_setup( source, target, cache );
+}
+
 void Method::execute( const FieldSet& source, FieldSet& target ) const {
     ATLAS_TRACE( "atlas::interpolation::method::Method::execute(FieldSet, FieldSet)" );
     this->do_execute( source, target );
@@ -200,16 +339,103 @@ void Method::do_setup( const FunctionSpace& /*source*/, const FieldSet& /*target
     ATLAS_NOTIMPLEMENTED;
 }
 
+void Method::do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& ) {
+    do_setup( source, target );
+}
+
+void Method::do_setup( const Grid& source, const Grid& target, const Cache& ) {
+    do_setup( source, target );
+}
+
+Cache Method::createCache() const {
+    if ( matrix_.empty() ) {
+        return Cache();
+    }
+    Matrix copy( matrix_ );
+    return MatrixCache( std::move( copy ) );
+}
+
+bool Method::setMatrix( const Cache& cache ) {
+    MatrixCache matrix_cache( cache );
+    if ( not matrix_cache ) {
+        return false;
+    }
+    Log::debug() << "Interpolation matrix taken from cache" << std::endl;
+    matrix_cache.view( matrix_ );
+    return true;
+}
+
 void Method::do_execute( const FieldSet& fieldsSource, FieldSet& fieldsTarget ) const {
     ATLAS_TRACE( "atlas::interpolation::method::Method::do_execute()" );
 
     const idx_t N = fieldsSource.size();
     ATLAS_ASSERT( N == fieldsTarget.size() );
 
-    for ( idx_t i = 0; i < fieldsSource.size(); ++i ) {
+    if ( matrix_.empty() || use_eckit_linalg_spmv_ ) {
+        for ( idx_t i = 0; i < fieldsSource.size(); ++i ) {
+            Log::debug() << "Method::do_execute() on field " << ( i + 1 ) << '/' << N << "..." << std::endl;
+            Method::do_execute( fieldsSource[i], fieldsTarget[i] );
+        }
+        return;
+    }
+
+    haloExchange( fieldsSource );
+
+    // Contiguous fields of the same data type are interpolated together in a single pass over the matrix
+    std::vector<idx_t> fused_double;
+    std::vector<idx_t> fused_float;
+    for ( idx_t i = 0; i < N; ++i ) {
+        const Field& src = fieldsSource[i];
+        const Field& tgt = fieldsTarget[i];
+        if ( src.contiguous() && tgt.contiguous() && src.datatype() == tgt.datatype() ) {
+            if ( src.datatype().kind() == array::DataType::KIND_REAL64 ) {
+                fused_double.push_back( i );
+                continue;
+            }
+            if ( src.datatype().kind() == array::DataType::KIND_REAL32 ) {
+                fused_float.push_back( i );
+                continue;
+            }
+        }
         Log::debug() << "Method::do_execute() on field " << ( i + 1 ) << '/' << N << "..." << std::endl;
         Method::do_execute( fieldsSource[i], fieldsTarget[i] );
     }
+
+    interpolate_fields<double>( fieldsSource, fieldsTarget, fused_double, matrix_ );
+    interpolate_fields<float>( fieldsSource, fieldsTarget, fused_float, matrix_ );
+
+    auto finalise = [&]( idx_t i, bool is_double ) {
+        const Field& src = fieldsSource[i];
+        Field& tgt       = fieldsTarget[i];
+
+        // non-linearities: overwrite rows affected by missing values
+        if ( nonLinear_( src ) ) {
+            NonLinear::Corrections corrections;
+            if ( nonLinear_.execute( matrix_, src, corrections ) ) {
+                if ( is_double ) {
+                    interpolate_field_corrections<double>( src, tgt, corrections );
+                }
+                else {
+                    interpolate_field_corrections<float>( src, tgt, corrections );
+                }
+            }
+        }
+
+        // carry over missing value metadata
+        field::MissingValue mv( src );
+        if ( mv ) {
+            mv.metadata( tgt );
+            ATLAS_ASSERT( field::MissingValue( tgt ) );
+        }
+
+        tgt.set_dirty();
+    };
+    for ( idx_t i : fused_double ) {
+        finalise( i, true );
+    }
+    for ( idx_t i : fused_float ) {
+        finalise( i, false );
+    }
 }
 
 void Method::do_execute( const Field& src, Field& tgt ) const {
@@ -217,20 +443,24 @@ void Method::do_execute( const Field& src, Field& tgt ) const {
 
     haloExchange( src );
 
-    // non-linearities: a non-empty M matrix contains the corrections applied to matrix_
-    Matrix M;
+    // non-linearities: corrections replace the rows of matrix_ affected by missing values, so that
+    // matrix_ itself is neither modified nor copied
+    NonLinear::Corrections corrections;
     if ( !matrix_.empty() && nonLinear_( src ) ) {
-        Matrix W( matrix_ );  // copy (a big penalty -- copy-on-write would definitely be better)
-        if ( nonLinear_->execute( W, src ) ) {
-            M.swap( W );
-        }
+        nonLinear_.execute( matrix_, src, corrections );
     }
 
     if ( src.datatype().kind() == array::DataType::KIND_REAL64 ) {
-        interpolate_field<double>( src, tgt, M.empty() ? matrix_ : M );
+        interpolate_field<double>( src, tgt, matrix_ );
+        if ( !corrections.empty() ) {
+            interpolate_field_corrections<double>( src, tgt, corrections );
+        }
     }
     else if ( src.datatype().kind() == array::DataType::KIND_REAL32 ) {
-        interpolate_field<float>( src, tgt, M.empty() ? matrix_ : M );
+        interpolate_field<float>( src, tgt, matrix_ );
+        if ( !corrections.empty() ) {
+            interpolate_field_corrections<float>( src, tgt, corrections );
+        }
     }
     else {
         ATLAS_NOTIMPLEMENTED;
@@ -262,8 +492,14 @@ void Method::normalise( Triplets& triplets ) {
 }
 
 void Method::haloExchange( const FieldSet& fields ) const {
+    FieldSet dirty;
     for ( auto& field : fields ) {
-        haloExchange( field );
+        if ( field.dirty() ) {
+            dirty.add( field );
+        }
+    }
+    if ( dirty.size() ) {
+        source().haloExchange( dirty );
     }
 }
 void Method::haloExchange( const Field& field ) const {
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "atlas/interpolation/NonLinear.h"
+#include "atlas/library/config.h"
 #include "atlas/util/Object.h"
 #include "eckit/config/Configuration.h"
 #include "eckit/linalg/SparseMatrix.h"
@@ -30,6 +31,9 @@ namespace atlas {
 namespace test {
 class Access;
 }
+namespace interpolation {
+class Cache;
+}
 }  // namespace atlas
 
 namespace atlas {
@@ -52,11 +56,21 @@ public:
     void setup( const FunctionSpace& source, const Field& target );
     void setup( const FunctionSpace& source, const FieldSet& target );
 
+    /**
+     * @brief Setup the interpolator, reusing a cached interpolation matrix when available
+     * @param cache created with createCache() or loaded from file (see MatrixCache)
+     */
+    void setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& );
+    void setup( const Grid& source, const Grid& target, const Cache& );
+
     void execute( const FieldSet& source, FieldSet& target ) const;
     void execute( const Field& source, Field& target ) const;
 
     virtual void print( std::ostream& ) const = 0;
 
+    /// Cache of the setup, empty for matrix-free interpolation methods
+    virtual Cache createCache() const;
+
     virtual const FunctionSpace& source() const = 0;
     virtual const FunctionSpace& target() const = 0;
 
@@ -73,6 +87,9 @@ protected:
     void haloExchange( const FieldSet& ) const;
     void haloExchange( const Field& ) const;
 
+    /// Share the matrix of given cache, returns false if the cache does not contain a matrix
+    bool setMatrix( const Cache& );
+
     // NOTE : Matrix-free or non-linear interpolation operators do not have matrices, so do not expose here
     friend class atlas::test::Access;
     Matrix matrix_;
@@ -85,6 +102,10 @@ protected:
     virtual void do_setup( const FunctionSpace& source, const Field& target );
     virtual void do_setup( const FunctionSpace& source, const FieldSet& target );
 
+    // Default implementations ignore the cache
+    virtual void do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& );
+    virtual void do_setup( const Grid& source, const Grid& target, const Cache& );
+
 private:
     template <typename Value>
     void interpolate_field( const Field& src, Field& tgt, const Matrix& ) const;
@@ -98,6 +119,15 @@ private:
     template <typename Value>
     void interpolate_field_rank3( const Field& src, Field& tgt, const Matrix& ) const;
 
+    /// Fused interpolation of the selected contiguous fields, in one pass over the matrix
+    template <typename Value>
+    void interpolate_fields( const FieldSet& src, FieldSet& tgt, const std::vector<idx_t>& fields,
+                             const Matrix& ) const;
+
+    /// Overwrite target rows which have corrected weights (computed by non-linear treatment)
+    template <typename Value>
+    void interpolate_field_corrections( const Field& src, Field& tgt, const NonLinear::Corrections& ) const;
+
     void check_compatibility( const Field& src, const Field& tgt, const Matrix& W ) const;
 };
 
@@ -9,18 +9,19 @@
  */
 
 #include <cmath>
+#include <exception>
 #include <iomanip>
 #include <limits>
 
 #include "FiniteElement.h"
 
 #include "eckit/log/Plural.h"
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/log/Seconds.h"
 
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/functionspace/PointCloud.h"
 #include "atlas/grid.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/interpolation/element/Quad3D.h"
 #include "atlas/interpolation/element/Triag3D.h"
 #include "atlas/interpolation/method/MethodFactory.h"
@@ -33,6 +34,7 @@
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -56,6 +58,10 @@ static const double parametricEpsilon = 1e-15;
 
 
 void FiniteElement::do_setup( const Grid& source, const Grid& target ) {
+    do_setup( source, target, Cache() );
+}
+
+void FiniteElement::do_setup( const Grid& source, const Grid& target, const Cache& cache ) {
     if ( mpi::size() > 1 ) {
         ATLAS_NOTIMPLEMENTED;
     }
@@ -70,7 +76,16 @@ void FiniteElement::do_setup( const Grid& source, const Grid& target ) {
         return functionspace::NodeColumns( mesh );
     };
 
-    do_setup( functionspace( source ), functionspace( target ) );
+    do_setup( functionspace( source ), functionspace( target ), cache );
+}
+
+void FiniteElement::do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& cache ) {
+    if ( setMatrix( cache ) ) {
+        source_ = source;
+        target_ = target;
+        return;
+    }
+    do_setup( source, target );
 }
 
 void FiniteElement::do_setup( const FunctionSpace& source, const FunctionSpace& target ) {
@@ -224,53 +239,96 @@ void FiniteElement::setup( const FunctionSpace& source ) {
     idx_t Nelements                    = meshSource.cells().size();
     const double maxFractionElemsToTry = 0.2;
 
-    // weights -- one per vertex of element, triangles (3) or quads (4)
-
-    Triplets weights_triplets;                 // structure to fill-in sparse matrix
-    weights_triplets.reserve( out_npts * 4 );  // preallocate space as if all elements where quads
-
     // search nearest k cell centres
 
     const idx_t maxNbElemsToTry = std::max<idx_t>( 64, idx_t( Nelements * maxFractionElemsToTry ) );
     idx_t max_neighbours        = 0;
 
+    // weights -- one per vertex of element, triangles (3) or quads (4)
+
+    Triplets weights_triplets;  // structure to fill-in sparse matrix
     std::vector<size_t> failures;
 
     ATLAS_TRACE_SCOPE( "Computing interpolation matrix" ) {
-        eckit::ProgressTimer progress( "Computing interpolation weights", out_npts, "point", double( 5 ),
-                                       Log::debug() );
-        for ( idx_t ip = 0; ip < out_npts; ++ip, ++progress ) {
-            if ( out_ghosts( ip ) ) {
-                continue;
-            }
+        // Target points are distributed over threads in chunks. Each chunk collects its own triplets and failures,
+        // which are concatenated in chunk order afterwards so that the result is identical to a serial loop.
+        const idx_t chunk_size = 1024;
+        const idx_t nb_chunks  = ( out_npts + chunk_size - 1 ) / chunk_size;
+        std::vector<Triplets> chunk_triplets( nb_chunks );
+        std::vector<std::vector<size_t>> chunk_failures( nb_chunks );
+        std::vector<std::string> chunk_failures_log( nb_chunks );
+        std::vector<idx_t> chunk_max_neighbours( nb_chunks, 0 );
+        std::vector<std::exception_ptr> chunk_exception( nb_chunks );  // exceptions cannot leave a parallel region
+
+        atlas_omp_pragma(omp parallel for schedule(dynamic,1))
+        for ( idx_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+            const idx_t begin = jchunk * chunk_size;
+            const idx_t end   = std::min( begin + chunk_size, out_npts );
+
+            Triplets& weights_chunk = chunk_triplets[jchunk];
+            weights_chunk.reserve( ( end - begin ) * 4 );  // preallocate space as if all elements where quads
+            std::ostringstream chunk_log;
+
+            try {
+                for ( idx_t ip = begin; ip < end; ++ip ) {
+                    if ( out_ghosts( ip ) ) {
+                        continue;
+                    }
+
+                    PointXYZ p{( *ocoords_ )( ip, 0 ), ( *ocoords_ )( ip, 1 ), ( *ocoords_ )( ip, 2 )};  // lookup point
 
-            PointXYZ p{( *ocoords_ )( ip, 0 ), ( *ocoords_ )( ip, 1 ), ( *ocoords_ )( ip, 2 )};  // lookup point
+                    idx_t kpts   = 1;
+                    bool success = false;
+                    std::ostringstream failures_log;
 
-            idx_t kpts   = 1;
-            bool success = false;
-            std::ostringstream failures_log;
+                    while ( !success && kpts <= maxNbElemsToTry ) {
+                        chunk_max_neighbours[jchunk] = std::max( kpts, chunk_max_neighbours[jchunk] );
 
-            while ( !success && kpts <= maxNbElemsToTry ) {
-                max_neighbours = std::max( kpts, max_neighbours );
+                        ElemIndex3::NodeList cs = eTree->kNearestNeighbours( p, kpts );
+                        Triplets triplets       = projectPointToElements( ip, cs, failures_log );
 
-                ElemIndex3::NodeList cs = eTree->kNearestNeighbours( p, kpts );
-                Triplets triplets       = projectPointToElements( ip, cs, failures_log );
+                        if ( triplets.size() ) {
+                            std::copy( triplets.begin(), triplets.end(), std::back_inserter( weights_chunk ) );
+                            success = true;
+                        }
+                        kpts *= 2;
+                    }
 
-                if ( triplets.size() ) {
-                    std::copy( triplets.begin(), triplets.end(), std::back_inserter( weights_triplets ) );
-                    success = true;
+                    if ( !success ) {
+                        chunk_failures[jchunk].push_back( ip );
+                        chunk_log << "---------------------------------------------------------------------------\n";
+                        const PointLonLat pll{out_lonlat( ip, 0 ), out_lonlat( ip, 1 )};
+                        chunk_log << "Failed to project point (lon,lat)=" << pll << '\n';
+                        chunk_log << failures_log.str();
+                    }
                 }
-                kpts *= 2;
             }
+            catch ( ... ) {
+                chunk_exception[jchunk] = std::current_exception();
+            }
+            chunk_failures_log[jchunk] = chunk_log.str();
+        }
 
-            if ( !success ) {
-                failures.push_back( ip );
-                Log::debug() << "------------------------------------------------------"
-                                "---------------------\n";
-                const PointLonLat pll{out_lonlat( ip, 0 ), out_lonlat( ip, 1 )};
-                Log::debug() << "Failed to project point (lon,lat)=" << pll << '\n';
-                Log::debug() << failures_log.str();
+        for ( const auto& exception : chunk_exception ) {
+            if ( exception ) {
+                std::rethrow_exception( exception );
+            }
+        }
+
+        size_t nb_triplets = 0;
+        for ( const auto& triplets : chunk_triplets ) {
+            nb_triplets += triplets.size();
+        }
+        weights_triplets.reserve( nb_triplets );
+        for ( idx_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+            weights_triplets.insert( weights_triplets.end(), chunk_triplets[jchunk].begin(),
+                                     chunk_triplets[jchunk].end() );
+            Triplets().swap( chunk_triplets[jchunk] );
+            failures.insert( failures.end(), chunk_failures[jchunk].begin(), chunk_failures[jchunk].end() );
+            if ( not chunk_failures_log[jchunk].empty() ) {
+                Log::debug() << chunk_failures_log[jchunk];
             }
+            max_neighbours = std::max( max_neighbours, chunk_max_neighbours[jchunk] );
         }
     }
     Log::debug() << "Maximum neighbours searched was " << eckit::Plural( max_neighbours, "element" ) << std::endl;
@@ -65,6 +65,10 @@ private:
 
     virtual void do_setup( const Grid& source, const Grid& target ) override;
 
+    virtual void do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& ) override;
+
+    virtual void do_setup( const Grid& source, const Grid& target, const Cache& ) override;
+
 protected:
     mesh::MultiBlockConnectivity* connectivity_;
     std::unique_ptr<array::ArrayView<double, 2>> icoords_;
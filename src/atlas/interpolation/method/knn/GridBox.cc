@@ -13,6 +13,7 @@
 #include "atlas/interpolation/method/knn/GridBox.h"
 
 #include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <vector>
 
@@ -183,6 +184,7 @@ GridBoxes::GridBoxes( const Grid& grid, bool gaussianWeightedLatitudes ) {
 
     clear();
     reserve( grid.size() );
+    rows_.reserve( x.nx().size() );
     for ( size_t j = 0; j < x.nx().size(); ++j ) {
         eckit::Fraction dx( x.dx()[j] );
         eckit::Fraction xmin( x.xmin()[j] );
@@ -197,6 +199,7 @@ GridBoxes::GridBoxes( const Grid& grid, bool gaussianWeightedLatitudes ) {
 
         eckit::Fraction lon0 = ( n * dx ) - ( dx / 2 );
         eckit::Fraction lon1 = lon0;
+        rows_.emplace_back( Row{size(), size_t( x.nx()[j] ), double( lon0 ), double( dx )} );
         for ( idx_t i = 0; i < x.nx()[j]; ++i ) {
             double lon0 = lon1;
             lon1 += dx;
@@ -214,6 +217,10 @@ GridBoxes::GridBoxes( const Grid& grid, bool gaussianWeightedLatitudes ) {
     }
 
     ATLAS_ASSERT( idx_t( size() ) == grid.size() );
+    ATLAS_ASSERT( lat.size() == rows_.size() + 1 );
+
+    parallels_.swap( lat );
+    periodic_ = periodic;
 }
 
 
@@ -233,6 +240,57 @@ double GridBoxes::getLongestGridBoxDiagonal() const {
 }
 
 
+void GridBoxes::candidates( const GridBox& box, std::vector<size_t>& candidates ) const {
+    ATLAS_ASSERT( structured() );
+    candidates.clear();
+
+    // Rows overlapping the box latitudes (parallels decrease), plus one row either side to absorb round-off
+    auto first = std::partition_point( parallels_.begin() + 1, parallels_.end(),
+                                       [&]( double lat ) { return lat >= box.north(); } ) -
+                 ( parallels_.begin() + 1 );
+    auto last = std::partition_point( parallels_.begin(), parallels_.end() - 1,
+                                      [&]( double lat ) { return lat > box.south(); } ) -
+                parallels_.begin();
+    size_t jbegin = first > 0 ? size_t( first - 1 ) : 0;
+    size_t jend   = std::min( rows_.size(), size_t( last + 1 ) );
+
+    // Columns overlapping the box longitudes, plus one column either side to absorb round-off
+    for ( size_t j = jbegin; j < jend; ++j ) {
+        const auto& row = rows_[j];
+
+        auto column = [&]( double lon ) { return static_cast<long>( std::floor( ( lon - row.lon0 ) / row.dx ) ); };
+        auto nx     = long( row.nx );
+        double w    = normalise( box.west(), row.lon0 );
+        double e    = w + ( box.east() - box.west() );
+
+        if ( periodic_ ) {
+            long ibegin = column( w ) - 1;
+            long iend   = column( e ) + 2;
+            if ( iend - ibegin >= nx ) {
+                ibegin = 0;
+                iend   = nx;
+            }
+            for ( long i = ibegin; i < iend; ++i ) {
+                candidates.push_back( row.begin + size_t( ( i + nx ) % nx ) );
+            }
+        }
+        else {
+            // (clipped rows: the box shifted by a globe either way can still overlap on almost global domains)
+            auto rbegin = candidates.size();
+            for ( double shift : {-GLOBE, 0., GLOBE} ) {
+                long ibegin = std::max( 0L, column( w + shift ) - 1 );
+                long iend   = std::min( nx, column( e + shift ) + 2 );
+                for ( long i = ibegin; i < iend; ++i ) {
+                    candidates.push_back( row.begin + size_t( i ) );
+                }
+            }
+            std::sort( candidates.begin() + rbegin, candidates.end() );
+            candidates.erase( std::unique( candidates.begin() + rbegin, candidates.end() ), candidates.end() );
+        }
+    }
+}
+
+
 }  // namespace method
 }  // namespace interpolation
 }  // namespace atlas
@@ -46,6 +46,11 @@ public:
 
     // -- Methods
 
+    double north() const { return north_; }
+    double west() const { return west_; }
+    double south() const { return south_; }
+    double east() const { return east_; }
+
     double area() const;
     double diagonal() const;
     bool intersects( GridBox& ) const;
@@ -113,6 +118,30 @@ struct GridBoxes : std::vector<GridBox> {
     GridBoxes();
     using std::vector<GridBox>::vector;
     double getLongestGridBoxDiagonal() const;
+
+    /// @brief If grid boxes are arranged in rows (constructed from a Grid)
+    bool structured() const { return !rows_.empty(); }
+
+    /**
+     * @brief Indices of the grid boxes that possibly intersect a given box, from the latitude/longitude ranges of the
+     * rows of grid boxes (no search tree required). Indices are a superset of the intersecting grid boxes, row by row
+     * from North to South.
+     * @param[in] box the box to intersect
+     * @param[out] candidates indices of the grid boxes
+     */
+    void candidates( const GridBox& box, std::vector<size_t>& candidates ) const;
+
+private:
+    struct Row {
+        size_t begin;  // index of first grid box
+        size_t nx;     // number of grid boxes
+        double lon0;   // western edge of first grid box (before clipping)
+        double dx;     // grid box width
+    };
+
+    std::vector<double> parallels_;  // row edges, from North to South
+    std::vector<Row> rows_;
+    bool periodic_ = false;
 };
 
 
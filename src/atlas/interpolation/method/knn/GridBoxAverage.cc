@@ -13,8 +13,6 @@
 
 #include <vector>
 
-#include "eckit/log/ProgressTimer.h"
-
 #include "atlas/array.h"
 #include "atlas/functionspace/PointCloud.h"
 #include "atlas/interpolation/method/MethodFactory.h"
@@ -76,30 +74,14 @@ void GridBoxAverage::do_execute( const Field& source, Field& target ) const {
     ATLAS_ASSERT( yarray.size() == idx_t( targetBoxes_.size() ) );
 
     yarray.assign( 0. );
-    failures_.clear();
 
 
     // interpolate
-    eckit::ProgressTimer progress( "Intersecting", targetBoxes_.size(), "grid box", double( 5. ) );
-
-    std::vector<Triplet> triplets;
-    size_t i = 0;
-    for ( auto p : tgt.iterate().lonlat() ) {
-        ++progress;
-
-        if ( intersect( i, targetBoxes_.at( i ), pTree_.closestPointsWithinRadius( p, searchRadius_ ), triplets ) ) {
-            auto& y = yarray[i];
-            for ( auto& t : triplets ) {
-                y += xarray[t.col()] * t.value();
-            }
+    intersect( [&]( size_t, std::vector<Triplet>& triplets ) {
+        for ( auto& t : triplets ) {
+            yarray[t.row()] += xarray[t.col()] * t.value();
         }
-
-        ++i;
-    }
-
-    if ( !failures_.empty() ) {
-        giveUp( failures_ );
-    }
+    } );
 }
 
 
@@ -15,7 +15,6 @@
 #include <limits>
 #include <vector>
 
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/types/FloatCompare.h"
 
 #include "atlas/array.h"
@@ -56,7 +55,6 @@ void GridBoxMaximum::do_execute( const Field& source, Field& target ) const {
     ATLAS_ASSERT( yarray.size() == idx_t( targetBoxes_.size() ) );
 
     yarray.assign( 0. );
-    failures_.clear();
 
 
     if ( !matrixFree_ ) {
@@ -92,29 +90,20 @@ void GridBoxMaximum::do_execute( const Field& source, Field& target ) const {
     ATLAS_ASSERT( !targetBoxes_.empty() );
 
 
-    // interpolate
-    eckit::ProgressTimer progress( "Intersecting", targetBoxes_.size(), "grid box", double( 5. ) );
+    // interpolate (triplets are in row order)
+    intersect( [&]( size_t, std::vector<Triplet>& triplets ) {
+        for ( auto t = triplets.begin(); t != triplets.end(); ) {
+            const auto row = t->row();
+            auto row_end   = std::find_if( t, triplets.end(), [&]( const Triplet& u ) { return u.row() != row; } );
 
-    std::vector<Triplet> triplets;
-    size_t i = 0;
-    for ( auto p : tgt.iterate().lonlat() ) {
-        ++progress;
+            auto triplet = std::max_element( t, row_end, []( const Triplet& a, const Triplet& b ) {
+                return !eckit::types::is_approximately_greater_or_equal( a.value(), b.value() );
+            } );
 
-        if ( intersect( i, targetBoxes_.at( i ), pTree_.closestPointsWithinRadius( p, searchRadius_ ), triplets ) ) {
-            auto triplet =
-                std::max_element( triplets.begin(), triplets.end(), []( const Triplet& a, const Triplet& b ) {
-                    return !eckit::types::is_approximately_greater_or_equal( a.value(), b.value() );
-                } );
-
-            yarray[i] = xarray[triplet->col()];
+            yarray[row] = xarray[triplet->col()];
+            t           = row_end;
         }
-
-        ++i;
-    }
-
-    if ( !failures_.empty() ) {
-        giveUp( failures_ );
-    }
+    } );
 }
 
 
@@ -12,17 +12,21 @@
 #include "atlas/interpolation/method/knn/GridBoxMethod.h"
 
 #include <algorithm>
+#include <exception>
 #include <vector>
 
 #include "eckit/log/Plural.h"
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/types/FloatCompare.h"
 
+#include "atlas/array.h"
 #include "atlas/grid.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/CoordinateEnums.h"
 
 
 namespace atlas {
@@ -49,24 +53,29 @@ void GridBoxMethod::do_setup( const FunctionSpace& /*source*/, const FunctionSpa
     ATLAS_NOTIMPLEMENTED;
 }
 
-bool GridBoxMethod::intersect( size_t i, const GridBox& box, const util::IndexKDTree::ValueList& closest,
+
+namespace {
+constexpr size_t chunk_size = 1024;  // number of target grid boxes intersected by one thread at a time
+}  // namespace
+
+
+bool GridBoxMethod::intersect( size_t i, const GridBox& box, const std::vector<size_t>& candidates,
                                std::vector<eckit::linalg::Triplet>& triplets ) const {
-    ASSERT( !closest.empty() );
+    ATLAS_ASSERT( !candidates.empty() );
 
     triplets.clear();
-    triplets.reserve( closest.size() );
+    triplets.reserve( candidates.size() );
 
     double area = box.area();
-    ASSERT( area > 0. );
+    ATLAS_ASSERT( area > 0. );
 
     double sumSmallAreas = 0.;
-    for ( auto& c : closest ) {
-        auto j        = c.payload();
+    for ( auto j : candidates ) {
         auto smallBox = sourceBoxes_.at( j );
 
         if ( box.intersects( smallBox ) ) {
             double smallArea = smallBox.area();
-            ASSERT( smallArea > 0. );
+            ATLAS_ASSERT( smallArea > 0. );
 
             triplets.emplace_back( i, j, smallArea / area );
             sumSmallAreas += smallArea;
@@ -77,18 +86,88 @@ bool GridBoxMethod::intersect( size_t i, const GridBox& box, const util::IndexKD
         }
     }
 
-    if ( failEarly_ ) {
-        Log::error() << "Failed to intersect grid box " << i << ", " << box << std::endl;
-        throw_Exception( "Failed to intersect grid box" );
-    }
-
-    failures_.push_front( i );
     triplets.clear();
     return false;
 }
 
 
+size_t GridBoxMethod::nbChunks() const {
+    return ( targetBoxes_.size() + chunk_size - 1 ) / chunk_size;
+}
+
+
+void GridBoxMethod::intersect( const std::function<void( size_t, std::vector<Triplet>& )>& apply ) const {
+    ATLAS_TRACE( "GridBoxMethod: intersecting grid boxes" );
+
+    // Without rows of source grid boxes, candidates are searched for around the target points
+    const bool structured = sourceBoxes_.structured();
+    const auto lonlat     = array::make_view<const double, 2>( functionspace::PointCloud( target_ ).lonlat() );
+
+    const size_t nb_chunks = nbChunks();
+    std::vector<std::vector<size_t>> chunk_failures( nb_chunks );
+    std::vector<std::exception_ptr> chunk_exception( nb_chunks );  // exceptions cannot leave a parallel region
+
+    atlas_omp_pragma(omp parallel for schedule(dynamic,1))
+    for ( size_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+        const size_t begin = jchunk * chunk_size;
+        const size_t end   = std::min( begin + chunk_size, targetBoxes_.size() );
+
+        try {
+            std::vector<size_t> candidates;
+            std::vector<Triplet> triplets;
+            std::vector<Triplet> chunk_triplets;
+            chunk_triplets.reserve( ( end - begin ) * 4 );
+
+            for ( size_t i = begin; i < end; ++i ) {
+                const auto& box = targetBoxes_[i];
+                if ( structured ) {
+                    sourceBoxes_.candidates( box, candidates );
+                }
+                else {
+                    candidates.clear();
+                    PointLonLat p{lonlat( i, LON ), lonlat( i, LAT )};
+                    for ( const auto& c : pTree_.closestPointsWithinRadius( p, searchRadius_ ) ) {
+                        candidates.push_back( size_t( c.payload() ) );
+                    }
+                }
+
+                if ( !candidates.empty() && intersect( i, box, candidates, triplets ) ) {
+                    chunk_triplets.insert( chunk_triplets.end(), triplets.begin(), triplets.end() );
+                }
+                else {
+                    chunk_failures[jchunk].push_back( i );
+                }
+            }
+
+            apply( jchunk, chunk_triplets );
+        }
+        catch ( ... ) {
+            chunk_exception[jchunk] = std::current_exception();
+        }
+    }
+
+    for ( const auto& exception : chunk_exception ) {
+        if ( exception ) {
+            std::rethrow_exception( exception );
+        }
+    }
+
+    std::vector<size_t> failures;
+    for ( const auto& f : chunk_failures ) {
+        failures.insert( failures.end(), f.begin(), f.end() );
+    }
+    if ( !failures.empty() ) {
+        giveUp( failures );
+    }
+}
+
+
 void GridBoxMethod::do_setup( const Grid& source, const Grid& target ) {
+    do_setup( source, target, Cache() );
+}
+
+
+void GridBoxMethod::do_setup( const Grid& source, const Grid& target, const Cache& cache ) {
     ATLAS_TRACE( "GridBoxMethod::setup()" );
 
     if ( mpi::size() > 1 ) {
@@ -105,13 +184,18 @@ void GridBoxMethod::do_setup( const Grid& source, const Grid& target ) {
     source_ = src;
     target_ = tgt;
 
-    buildPointSearchTree( src );
-
     sourceBoxes_ = GridBoxes( source, gaussianWeightedLatitudes_ );
     targetBoxes_ = GridBoxes( target, gaussianWeightedLatitudes_ );
 
+    if ( not matrixFree_ && setMatrix( cache ) ) {
+        return;
+    }
+
+    if ( !sourceBoxes_.structured() ) {
+        buildPointSearchTree( src );
+    }
+
     searchRadius_ = sourceBoxes_.getLongestGridBoxDiagonal() + targetBoxes_.getLongestGridBoxDiagonal();
-    failures_.clear();
 
     if ( matrixFree_ ) {
         Matrix A;
@@ -119,28 +203,20 @@ void GridBoxMethod::do_setup( const Grid& source, const Grid& target ) {
         return;
     }
 
-    std::vector<Triplet> allTriplets;
+    // Triplets of every chunk of target grid boxes are concatenated in chunk (row) order
+    std::vector<std::vector<Triplet>> chunk_triplets( nbChunks() );
+    intersect( [&]( size_t jchunk, std::vector<Triplet>& triplets ) { chunk_triplets[jchunk].swap( triplets ); } );
 
+    std::vector<Triplet> allTriplets;
     {
-        ATLAS_TRACE( "GridBoxMethod::setup: intersecting grid boxes" );
-
-        eckit::ProgressTimer progress( "Intersecting", targetBoxes_.size(), "grid box", double( 5. ) );
-
-        std::vector<Triplet> triplets;
-        size_t i = 0;
-        for ( auto p : tgt.iterate().lonlat() ) {
-            ++progress;
-
-            if ( intersect( i, targetBoxes_.at( i ), pTree_.closestPointsWithinRadius( p, searchRadius_ ),
-                            triplets ) ) {
-                std::copy( triplets.begin(), triplets.end(), std::back_inserter( allTriplets ) );
-            }
-
-            ++i;
+        size_t nb_triplets = 0;
+        for ( const auto& triplets : chunk_triplets ) {
+            nb_triplets += triplets.size();
         }
-
-        if ( !failures_.empty() ) {
-            giveUp( failures_ );
+        allTriplets.reserve( nb_triplets );
+        for ( auto& triplets : chunk_triplets ) {
+            allTriplets.insert( allTriplets.end(), triplets.begin(), triplets.end() );
+            std::vector<Triplet>().swap( triplets );
         }
     }
 
@@ -152,7 +228,15 @@ void GridBoxMethod::do_setup( const Grid& source, const Grid& target ) {
 }
 
 
-void GridBoxMethod::giveUp( const std::forward_list<size_t>& failures ) {
+void GridBoxMethod::giveUp( const std::vector<size_t>& failures ) const {
+    ATLAS_ASSERT( !failures.empty() );
+
+    if ( failEarly_ ) {
+        auto i = failures.front();
+        Log::error() << "Failed to intersect grid box " << i << ", " << targetBoxes_.at( i ) << std::endl;
+        throw_Exception( "Failed to intersect grid box" );
+    }
+
     Log::warning() << "Failed to intersect grid boxes: ";
 
     size_t count = 0;
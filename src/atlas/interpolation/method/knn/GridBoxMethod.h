@@ -13,7 +13,8 @@
 
 #include "atlas/interpolation/method/knn/KNearestNeighboursBase.h"
 
-#include <forward_list>
+#include <functional>
+#include <vector>
 
 #include "atlas/functionspace.h"
 #include "atlas/interpolation/method/knn/GridBox.h"
@@ -39,17 +40,38 @@ protected:
      */
     virtual void do_setup( const FunctionSpace& source, const FunctionSpace& target ) override;
     virtual void do_setup( const Grid& source, const Grid& target ) override;
+    virtual void do_setup( const Grid& source, const Grid& target, const Cache& ) override;
 
     virtual const FunctionSpace& source() const override { return source_; }
     virtual const FunctionSpace& target() const override { return target_; }
 
-    bool intersect( size_t i, const GridBox& iBox, const util::IndexKDTree::ValueList&, std::vector<Triplet>& ) const;
+    /**
+     * @brief Intersect a target grid box with candidate source grid boxes (thread-safe)
+     * @param i target grid box index
+     * @param iBox target grid box
+     * @param candidates indices of source grid boxes possibly intersecting the target grid box
+     * @param triplets interpolation weights (area fractions) of the intersected source grid boxes
+     * @return if the source grid boxes cover the target grid box (otherwise triplets are empty)
+     */
+    bool intersect( size_t i, const GridBox& iBox, const std::vector<size_t>& candidates,
+                    std::vector<Triplet>& triplets ) const;
+
+    /**
+     * @brief Intersect all target grid boxes with source grid boxes, in parallel over chunks of target grid boxes.
+     * Candidate source grid boxes come from their rows if structured, or from the search tree otherwise.
+     * @param apply called for every chunk with its index and triplets (in row order), concurrently for different
+     * chunks
+     */
+    void intersect( const std::function<void( size_t jchunk, std::vector<Triplet>& triplets )>& apply ) const;
+
+    /// @brief Number of chunks of target grid boxes intersected by intersect( apply )
+    size_t nbChunks() const;
 
     virtual void do_execute( const FieldSet& source, FieldSet& target ) const override = 0;
     virtual void do_execute( const Field& source, Field& target ) const override       = 0;
 
 protected:
-    static void giveUp( const std::forward_list<size_t>& );
+    void giveUp( const std::vector<size_t>& ) const;
 
     FunctionSpace source_;
     FunctionSpace target_;
@@ -59,8 +81,6 @@ protected:
 
     double searchRadius_;
 
-    mutable std::forward_list<size_t> failures_;
-
     bool matrixFree_;
     bool failEarly_;
     bool gaussianWeightedLatitudes_;
@@ -10,19 +10,20 @@
 
 #include "atlas/interpolation/method/knn/KNearestNeighbours.h"
 
-#include <limits>
+#include <algorithm>
 
 #include "eckit/log/Plural.h"
-#include "eckit/types/FloatCompare.h"
 
 #include "atlas/array.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/grid.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/interpolation/method/MethodFactory.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildXYZField.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -45,6 +46,10 @@ KNearestNeighbours::KNearestNeighbours( const Method::Config& config ) : KNeares
 }
 
 void KNearestNeighbours::do_setup( const Grid& source, const Grid& target ) {
+    do_setup( source, target, Cache() );
+}
+
+void KNearestNeighbours::do_setup( const Grid& source, const Grid& target, const Cache& cache ) {
     if ( mpi::size() > 1 ) {
         ATLAS_NOTIMPLEMENTED;
     }
@@ -59,7 +64,16 @@ void KNearestNeighbours::do_setup( const Grid& source, const Grid& target ) {
         return functionspace::NodeColumns( mesh );
     };
 
-    do_setup( functionspace( source ), functionspace( target ) );
+    do_setup( functionspace( source ), functionspace( target ), cache );
+}
+
+void KNearestNeighbours::do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& cache ) {
+    if ( setMatrix( cache ) ) {
+        source_ = source;
+        target_ = target;
+        return;
+    }
+    do_setup( source, target );
 }
 
 void KNearestNeighbours::do_setup( const FunctionSpace& source, const FunctionSpace& target ) {
@@ -84,48 +98,89 @@ void KNearestNeighbours::do_setup( const FunctionSpace& source, const FunctionSp
 
     // fill the sparse matrix
     std::vector<Triplet> weights_triplets;
-    weights_triplets.reserve( out_npts * k_ );
     {
         Trace timer( Here(), "atlas::interpolation::method::NearestNeighbour::do_setup()" );
 
-        std::vector<double> weights;
-
         Log::debug() << "Computing interpolation weights for " << out_npts << " points." << std::endl;
-        for ( size_t ip = 0; ip < out_npts; ++ip ) {
-            if ( ip && ( ip % 1000 == 0 ) ) {
-                auto elapsed = timer.elapsed();
-                auto rate    = eckit::types::is_approximately_equal( elapsed, 0. )
-                                ? std::numeric_limits<double>::infinity()
-                                : ( ip / elapsed );
-                Log::debug() << eckit::BigNum( ip ) << " (at " << rate << " points/s)..." << std::endl;
-            }
-
-            // find the closest input points to the output point
-            auto nn = pTree_.closestPoints( PointLonLat{lonlat( ip, size_t( LON ) ), lonlat( ip, size_t( LAT ) )}, k_ );
 
-            // calculate weights (individual and total, to normalise) using distance
-            // squared
-            const size_t npts = nn.size();
-            ATLAS_ASSERT( npts );
-            weights.resize( npts, 0 );
-
-            double sum = 0;
-            for ( size_t j = 0; j < npts; ++j ) {
-                const double d  = nn[j].distance();
-                const double d2 = d * d;
-
-                weights[j] = 1. / ( 1. + d2 );
-                sum += weights[j];
+        // Target points are queried in blocks, so that the neighbours of only one block are held at a time.
+        // Within a block, chunks of rows are assembled by separate threads, and concatenated in row order.
+        const size_t block_size = 65536;
+        const size_t chunk_size = 1024;
+        std::vector<std::vector<Triplet>> chunk_triplets;
+        std::vector<PointLonLat> points;
+        for ( size_t block_begin = 0; block_begin < out_npts; block_begin += block_size ) {
+            const size_t block_end = std::min( block_begin + block_size, out_npts );
+
+            // find the closest input points to the output points of this block
+            points.resize( block_end - block_begin );
+            for ( size_t ip = block_begin; ip < block_end; ++ip ) {
+                points[ip - block_begin] = PointLonLat{lonlat( ip, size_t( LON ) ), lonlat( ip, size_t( LAT ) )};
             }
-            ATLAS_ASSERT( sum > 0 );
-
-            // insert weights into the matrix
-            for ( size_t j = 0; j < npts; ++j ) {
-                size_t jp = nn[j].payload();
-                ATLAS_ASSERT( jp < inp_npts,
-                              "point found which is not covered within the halo of the source function space" );
-                weights_triplets.emplace_back( ip, jp, weights[j] / sum );
+            const auto neighbours = pTree_.closestPoints( points, k_ );
+            for ( const auto& nn : neighbours ) {
+                ATLAS_ASSERT( nn.size() );
+            }
+
+            // calculate weights (individual and total, to normalise) using distance squared
+            const size_t first_chunk = chunk_triplets.size();
+            const size_t nb_chunks   = ( block_end - block_begin + chunk_size - 1 ) / chunk_size;
+            chunk_triplets.resize( first_chunk + nb_chunks );
+            size_t nb_outside_halo = 0;
+            size_t nb_zero_sum     = 0;
+
+            atlas_omp_pragma(omp parallel for schedule(dynamic,1) reduction(+:nb_outside_halo,nb_zero_sum))
+            for ( size_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+                const size_t begin = block_begin + jchunk * chunk_size;
+                const size_t end   = std::min( begin + chunk_size, block_end );
+
+                std::vector<Triplet>& triplets = chunk_triplets[first_chunk + jchunk];
+                triplets.reserve( ( end - begin ) * k_ );
+                std::vector<double> weights;
+
+                for ( size_t ip = begin; ip < end; ++ip ) {
+                    const auto& nn    = neighbours[ip - block_begin];
+                    const size_t npts = nn.size();
+                    weights.resize( npts, 0 );
+
+                    double sum = 0;
+                    for ( size_t j = 0; j < npts; ++j ) {
+                        const double d  = nn[j].distance();
+                        const double d2 = d * d;
+
+                        weights[j] = 1. / ( 1. + d2 );
+                        sum += weights[j];
+                    }
+                    // Assertions cannot be thrown from the parallel loop, and are checked after it
+                    if ( not( sum > 0 ) ) {
+                        ++nb_zero_sum;
+                        continue;
+                    }
+
+                    // insert weights into the matrix
+                    for ( size_t j = 0; j < npts; ++j ) {
+                        size_t jp = nn[j].payload();
+                        if ( jp >= inp_npts ) {
+                            ++nb_outside_halo;
+                            continue;
+                        }
+                        triplets.emplace_back( ip, jp, weights[j] / sum );
+                    }
+                }
             }
+            ATLAS_ASSERT( nb_zero_sum == 0 );
+            ATLAS_ASSERT( nb_outside_halo == 0,
+                          "point found which is not covered within the halo of the source function space" );
+        }
+
+        size_t nb_triplets = 0;
+        for ( const auto& triplets : chunk_triplets ) {
+            nb_triplets += triplets.size();
+        }
+        weights_triplets.reserve( nb_triplets );
+        for ( auto& triplets : chunk_triplets ) {
+            weights_triplets.insert( weights_triplets.end(), triplets.begin(), triplets.end() );
+            std::vector<Triplet>().swap( triplets );
         }
     }
 
@@ -10,14 +10,12 @@
 
 #include "atlas/interpolation/method/knn/NearestNeighbour.h"
 
-#include <limits>
-
 #include "eckit/log/Plural.h"
-#include "eckit/types/FloatCompare.h"
 
 #include "atlas/array.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/grid.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/interpolation/method/MethodFactory.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildXYZField.h"
@@ -39,6 +37,10 @@ MethodBuilder<NearestNeighbour> __builder( "nearest-neighbour" );
 }  // namespace
 
 void NearestNeighbour::do_setup( const Grid& source, const Grid& target ) {
+    do_setup( source, target, Cache() );
+}
+
+void NearestNeighbour::do_setup( const Grid& source, const Grid& target, const Cache& cache ) {
     if ( mpi::size() > 1 ) {
         ATLAS_NOTIMPLEMENTED;
     }
@@ -53,7 +55,16 @@ void NearestNeighbour::do_setup( const Grid& source, const Grid& target ) {
         return functionspace::NodeColumns( mesh );
     };
 
-    do_setup( functionspace( source ), functionspace( target ) );
+    do_setup( functionspace( source ), functionspace( target ), cache );
+}
+
+void NearestNeighbour::do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& cache ) {
+    if ( setMatrix( cache ) ) {
+        source_ = source;
+        target_ = target;
+        return;
+    }
+    do_setup( source, target );
 }
 
 void NearestNeighbour::do_setup( const FunctionSpace& source, const FunctionSpace& target ) {
@@ -81,18 +92,16 @@ void NearestNeighbour::do_setup( const FunctionSpace& source, const FunctionSpac
     weights_triplets.reserve( out_npts );
     {
         Trace timer( Here(), "atlas::interpolation::method::NearestNeighbour::do_setup()" );
+
+        // find the closest input point to all output points
+        std::vector<PointLonLat> points( out_npts );
+        for ( size_t ip = 0; ip < out_npts; ++ip ) {
+            points[ip] = PointLonLat{lonlat( ip, size_t( LON ) ), lonlat( ip, size_t( LAT ) )};
+        }
+        const auto nearest = pTree_.closestPoint( points );
+
         for ( size_t ip = 0; ip < out_npts; ++ip ) {
-            if ( ip && ( ip % 1000 == 0 ) ) {
-                auto elapsed = timer.elapsed();
-                auto rate    = eckit::types::is_approximately_equal( elapsed, 0. )
-                                ? std::numeric_limits<double>::infinity()
-                                : ( ip / elapsed );
-                Log::debug() << eckit::BigNum( ip ) << " (at " << rate << " points/s)..." << std::endl;
-            }
-
-            // find the closest input point to the output point
-            auto nn   = pTree_.closestPoint( PointLonLat{lonlat( ip, size_t( LON ) ), lonlat( ip, size_t( LAT ) )} );
-            size_t jp = nn.payload();
+            size_t jp = nearest[ip].payload();
 
             // insert the weights into the interpolant matrix
             ATLAS_ASSERT( jp < inp_npts,
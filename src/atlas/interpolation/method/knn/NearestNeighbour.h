@@ -42,6 +42,10 @@ private:
 
     virtual void do_setup( const Grid& source, const Grid& target ) override;
 
+    virtual void do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& ) override;
+
+    virtual void do_setup( const Grid& source, const Grid& target, const Cache& ) override;
+
     FunctionSpace source_;
     FunctionSpace target_;
 };
@@ -13,6 +13,7 @@
 #include "atlas/interpolation/method/Method.h"
 
 #include <memory>
+#include <vector>
 
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
@@ -28,6 +29,10 @@ namespace method {
  * Horizontal interpolation making use of Structure of grid
  * Multiple (vertical) levels can be interpolated as well but
  * assumes that input and output levels are the same.
+ *
+ * With "matrix_free" set, the option "cache_weights" stores the stencils and weights
+ * of the first execution and reuses them, which is only valid while the target
+ * coordinates do not change.
  */
 
 template <typename Kernel>
@@ -56,6 +61,10 @@ private:
 
     virtual void do_setup( const FunctionSpace& source, const FieldSet& target ) override;
 
+    virtual void do_setup( const Grid& source, const Grid& target, const Cache& ) override;
+
+    virtual void do_setup( const FunctionSpace& source, const FunctionSpace& target, const Cache& ) override;
+
     virtual void do_execute( const Field& src, Field& tgt ) const override;
 
     virtual void do_execute( const FieldSet& src, FieldSet& tgt ) const override;
@@ -75,8 +84,12 @@ protected:
     FunctionSpace target_;
 
     bool matrix_free_;
+    bool cache_weights_;
 
     std::unique_ptr<Kernel> kernel_;
+
+    // Filled by the first matrix-free execution with "cache_weights"
+    mutable std::vector<typename Kernel::WorkSpace> cache_;
 };
 
 
@@ -21,6 +21,7 @@
 #include "atlas/functionspace/StructuredColumns.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/StructuredGrid.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/omp.h"
@@ -50,13 +51,21 @@ double StructuredInterpolation2D<Kernel>::convert_units_multiplier( const Field&
 template <typename Kernel>
 StructuredInterpolation2D<Kernel>::StructuredInterpolation2D( const Method::Config& config ) :
     Method( config ),
-    matrix_free_{false} {
+    matrix_free_{false},
+    cache_weights_{false} {
     config.get( "matrix_free", matrix_free_ );
+    config.get( "cache_weights", cache_weights_ );
 }
 
 
 template <typename Kernel>
 void StructuredInterpolation2D<Kernel>::do_setup( const Grid& source, const Grid& target ) {
+    do_setup( source, target, Cache() );
+}
+
+
+template <typename Kernel>
+void StructuredInterpolation2D<Kernel>::do_setup( const Grid& source, const Grid& target, const Cache& cache ) {
     if ( mpi::size() > 1 ) {
         ATLAS_NOTIMPLEMENTED;
     }
@@ -68,7 +77,19 @@ void StructuredInterpolation2D<Kernel>::do_setup( const Grid& source, const Grid
     // guarantee "1" halo for pole treatment!
     FunctionSpace target_fs = functionspace::PointCloud( target );
 
-    do_setup( source_fs, target_fs );
+    do_setup( source_fs, target_fs, cache );
+}
+
+
+template <typename Kernel>
+void StructuredInterpolation2D<Kernel>::do_setup( const FunctionSpace& source, const FunctionSpace& target,
+                                                  const Cache& cache ) {
+    if ( not matrix_free_ && setMatrix( cache ) ) {
+        source_ = source;
+        target_ = target;
+        return;
+    }
+    do_setup( source, target );
 }
 
 
@@ -140,6 +161,7 @@ void StructuredInterpolation2D<Kernel>::print( std::ostream& ) const {
 template <typename Kernel>
 void StructuredInterpolation2D<Kernel>::setup( const FunctionSpace& source ) {
     kernel_.reset( new Kernel( source ) );
+    cache_.clear();
 
     if ( functionspace::StructuredColumns( source ).halo() < 1 ) {
         throw_Exception( "The source functionspace must have (halo >= 1) for pole treatment" );
@@ -258,6 +280,31 @@ void StructuredInterpolation2D<Kernel>::execute_impl( const Kernel& kernel, cons
         src_view.emplace_back( array::make_view<Value, Rank>( src_fields[i] ) );
         tgt_view.emplace_back( array::make_view<Value, Rank>( tgt_fields[i] ) );
     }
+
+    // Stencil and weights per target point: computed on the fly, or taken from cache_ once filled
+    const bool use_cache  = not cache_.empty();
+    const bool fill_cache = cache_weights_ && not use_cache;
+    auto prepare_cache    = [&]( idx_t size ) {
+        if ( fill_cache ) {
+            cache_.resize( size );
+        }
+        if ( use_cache ) {
+            ATLAS_ASSERT( cache_.size() == size_t( size ) );
+        }
+    };
+    auto stencil_and_weights = [&]( idx_t jpoint, const PointLonLat& p,
+                                    typename Kernel::WorkSpace& workspace ) -> const typename Kernel::WorkSpace& {
+        if ( use_cache ) {
+            return cache_[jpoint];
+        }
+        kernel.compute_stencil( p.lon(), p.lat(), workspace.stencil );
+        kernel.compute_weights( p.lon(), p.lat(), workspace.stencil, workspace.weights );
+        if ( fill_cache ) {
+            cache_[jpoint] = workspace;
+        }
+        return workspace;
+    };
+
     if ( target_lonlat_ ) {
         double convert_units = convert_units_multiplier( target_lonlat_ );
 
@@ -266,16 +313,15 @@ void StructuredInterpolation2D<Kernel>::execute_impl( const Kernel& kernel, cons
             auto ghost     = array::make_view<int, 1>( target_ghost_ );
             auto lonlat    = array::make_view<double, 2>( target_lonlat_ );
 
+            prepare_cache( out_npts );
             atlas_omp_parallel {
-                typename Kernel::Stencil stencil;
-                typename Kernel::Weights weights;
+                typename Kernel::WorkSpace workspace;
                 atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
                     if ( not ghost( n ) ) {
                         PointLonLat p{lonlat( n, LON ) * convert_units, lonlat( n, LAT ) * convert_units};
-                        kernel.compute_stencil( p.lon(), p.lat(), stencil );
-                        kernel.compute_weights( p.lon(), p.lat(), stencil, weights );
+                        const auto& ws = stencil_and_weights( n, p, workspace );
                         for ( idx_t i = 0; i < N; ++i ) {
-                            kernel.interpolate( stencil, weights, src_view[i], tgt_view[i], n );
+                            kernel.interpolate( ws.stencil, ws.weights, src_view[i], tgt_view[i], n );
                         }
                     }
                 }
@@ -285,15 +331,14 @@ void StructuredInterpolation2D<Kernel>::execute_impl( const Kernel& kernel, cons
             idx_t out_npts    = target_lonlat_.shape( 0 );
             const auto lonlat = array::make_view<double, 2>( target_lonlat_ );
 
+            prepare_cache( out_npts );
             atlas_omp_parallel {
-                typename Kernel::Stencil stencil;
-                typename Kernel::Weights weights;
+                typename Kernel::WorkSpace workspace;
                 atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
                     PointLonLat p{lonlat( n, LON ) * convert_units, lonlat( n, LAT ) * convert_units};
-                    kernel.compute_stencil( p.lon(), p.lat(), stencil );
-                    kernel.compute_weights( p.lon(), p.lat(), stencil, weights );
+                    const auto& ws = stencil_and_weights( n, p, workspace );
                     for ( idx_t i = 0; i < N; ++i ) {
-                        kernel.interpolate( stencil, weights, src_view[i], tgt_view[i], n );
+                        kernel.interpolate( ws.stencil, ws.weights, src_view[i], tgt_view[i], n );
                     }
                 }
             }
@@ -305,15 +350,14 @@ void StructuredInterpolation2D<Kernel>::execute_impl( const Kernel& kernel, cons
         const auto lat       = array::make_view<double, 1>( target_lonlat_fields_[LAT] );
         double convert_units = convert_units_multiplier( target_lonlat_fields_[LON] );
 
+        prepare_cache( out_npts );
         atlas_omp_parallel {
-            typename Kernel::Stencil stencil;
-            typename Kernel::Weights weights;
+            typename Kernel::WorkSpace workspace;
             atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
                 PointLonLat p{lon( n ) * convert_units, lat( n ) * convert_units};
-                kernel.compute_stencil( p.lon(), p.lat(), stencil );
-                kernel.compute_weights( p.lon(), p.lat(), stencil, weights );
+                const auto& ws = stencil_and_weights( n, p, workspace );
                 for ( idx_t i = 0; i < N; ++i ) {
-                    kernel.interpolate( stencil, weights, src_view[i], tgt_view[i], n );
+                    kernel.interpolate( ws.stencil, ws.weights, src_view[i], tgt_view[i], n );
                 }
             }
         }
@@ -13,6 +13,8 @@
 #include "atlas/interpolation/method/Method.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
@@ -27,6 +29,10 @@ namespace method {
  * @class StructuredInterpolation3D
  *
  * Three-dimensional interpolation making use of Structure of grid.
+ *
+ * The option "cache_weights" stores the stencils and weights of the first
+ * execution and reuses them, which is only valid while the target
+ * coordinates do not change (e.g. not for semi-Lagrangian departure points).
  */
 
 template <typename Kernel>
@@ -77,8 +83,15 @@ protected:
 
     bool matrix_free_;
     bool limiter_;
+    bool cache_weights_;
 
     std::unique_ptr<Kernel> kernel_;
+
+    // Stencils and weights of all target points, stored by the first execution when "cache_weights" is set
+    mutable std::vector<typename Kernel::WorkSpace> cache_;
+
+    // Number of target points and levels of the cached entries
+    mutable std::pair<idx_t, idx_t> cache_layout_{0, 0};
 };
 
 
@@ -48,9 +48,11 @@ template <typename Kernel>
 StructuredInterpolation3D<Kernel>::StructuredInterpolation3D( const Method::Config& config ) :
     Method( config ),
     matrix_free_{false},
-    limiter_{false} {
+    limiter_{false},
+    cache_weights_{false} {
     config.get( "matrix_free", matrix_free_ );
     config.get( "limiter", limiter_ );
+    config.get( "cache_weights", cache_weights_ );
 
     if ( not matrix_free_ ) {
         throw_NotImplemented( "Matrix-free StructuredInterpolation3D not implemented", Here() );
@@ -132,6 +134,8 @@ void StructuredInterpolation3D<Kernel>::print( std::ostream& ) const {
 template <typename Kernel>
 void StructuredInterpolation3D<Kernel>::setup( const FunctionSpace& source ) {
     kernel_.reset( new Kernel( source, util::Config( "limiter", limiter_ ) ) );
+    cache_.clear();
+    cache_layout_ = std::make_pair( 0, 0 );
 }
 
 
@@ -213,6 +217,33 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
         }
     }
 
+    // With "cache_weights", the stencils and weights computed by the first execution are stored, so that later
+    // executions to the same target points only have to apply them. The cache is indexed by n * nlev + k, and is
+    // stored again when an execution has a different target layout (points and levels)
+    bool use_cache     = false;
+    bool fill_cache    = false;
+    auto prepare_cache = [&]( idx_t npts, idx_t nlev ) {
+        const auto layout = std::make_pair( npts, nlev );
+        use_cache         = not cache_.empty() && cache_layout_ == layout;
+        fill_cache        = cache_weights_ && not use_cache;
+        if ( fill_cache ) {
+            cache_.resize( size_t( npts ) * size_t( nlev ) );
+            cache_layout_ = layout;
+        }
+    };
+    auto stencil_and_weights = [&]( idx_t jpoint, double x, double y, double z,
+                                    typename Kernel::WorkSpace& workspace ) -> const typename Kernel::WorkSpace& {
+        if ( use_cache ) {
+            return cache_[jpoint];
+        }
+        kernel.compute_stencil( x, y, z, workspace.stencil );
+        kernel.compute_weights( x, y, z, workspace.stencil, workspace.weights );
+        if ( fill_cache ) {
+            cache_[jpoint] = workspace;
+        }
+        return workspace;
+    };
+
     if ( functionspace::PointCloud( target() ) && tgt_rank == 1 ) {
         const idx_t out_npts = target_lonlat_.shape( 0 );
 
@@ -230,18 +261,17 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
         }
 
         const double convert_units = convert_units_multiplier( target_lonlat_ );
+        prepare_cache( out_npts, 1 );
         atlas_omp_parallel {
-            typename Kernel::Stencil stencil;
-            typename Kernel::Weights weights;
+            typename Kernel::WorkSpace workspace;
             atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
                 if ( not ghost( n ) ) {
-                    double x = lonlat( n, LON ) * convert_units;
-                    double y = lonlat( n, LAT ) * convert_units;
-                    double z = vertical( n );
-                    kernel.compute_stencil( x, y, z, stencil );
-                    kernel.compute_weights( x, y, z, stencil, weights );
+                    double x       = lonlat( n, LON ) * convert_units;
+                    double y       = lonlat( n, LAT ) * convert_units;
+                    double z       = vertical( n );
+                    const auto& ws = stencil_and_weights( n, x, y, z, workspace );
                     for ( idx_t i = 0; i < N; ++i ) {
-                        kernel.interpolate( stencil, weights, src_view[i], tgt_view[i], n );
+                        kernel.interpolate( ws.stencil, ws.weights, src_view[i], tgt_view[i], n );
                     }
                 }
             }
@@ -271,20 +301,19 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
         }
 
         const double convert_units = convert_units_multiplier( target_3d_ );
+        prepare_cache( out_npts, out_nlev );
 
         atlas_omp_parallel {
-            typename Kernel::Stencil stencil;
-            typename Kernel::Weights weights;
+            typename Kernel::WorkSpace workspace;
             atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
                 for ( idx_t k = 0; k < out_nlev; ++k ) {
                     double x = coords( n, k, LON ) * convert_units;
                     double y = coords( n, k, LAT ) * convert_units;
                     double z = coords( n, k, ZZ );
 
-                    kernel.compute_stencil( x, y, z, stencil );
-                    kernel.compute_weights( x, y, z, stencil, weights );
+                    const auto& ws = stencil_and_weights( n * out_nlev + k, x, y, z, workspace );
                     for ( idx_t i = 0; i < N; ++i ) {
-                        kernel.interpolate( stencil, weights, src_view[i], tgt_view[i], n, k );
+                        kernel.interpolate( ws.stencil, ws.weights, src_view[i], tgt_view[i], n, k );
                     }
                 }
             }
@@ -316,19 +345,18 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
         }
 
         const double convert_units = convert_units_multiplier( target_xyz_[LON] );
+        prepare_cache( out_npts, out_nlev );
 
         atlas_omp_parallel {
-            typename Kernel::Stencil stencil;
-            typename Kernel::Weights weights;
+            typename Kernel::WorkSpace workspace;
             atlas_omp_for( idx_t n = 0; n < out_npts; ++n ) {
                 for ( idx_t k = 0; k < out_nlev; ++k ) {
                     const double x = xcoords( n, k ) * convert_units;
                     const double y = ycoords( n, k ) * convert_units;
                     const double z = zcoords( n, k );
-                    kernel.compute_stencil( x, y, z, stencil );
-                    kernel.compute_weights( x, y, z, stencil, weights );
+                    const auto& ws = stencil_and_weights( n * out_nlev + k, x, y, z, workspace );
                     for ( idx_t i = 0; i < N; ++i ) {
-                        kernel.interpolate( stencil, weights, src_view[i], tgt_view[i], n, k );
+                        kernel.interpolate( ws.stencil, ws.weights, src_view[i], tgt_view[i], n, k );
                     }
                 }
             }
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "eckit/types/FloatCompare.h"
 
 #include "atlas/field/MissingValue.h"
@@ -26,12 +28,24 @@ namespace nonlinear {
 struct Missing : NonLinear {
 private:
     bool applicable( const Field& f ) const override { return field::MissingValue( f ); }
-};
 
-
-template <typename T>
-struct MissingIfAllMissing : Missing {
-    bool execute( NonLinear::Matrix& W, const Field& field ) const {
+protected:
+    /**
+     * @brief Apply a row re-weighting policy to all rows of W affected by missing values
+     * @param [in] W interpolation matrix
+     * @param [in] field field with missing values information
+     * @param [out] data weights to overwrite in-place (aliasing W.data()), or nullptr
+     * @param [out] corrections corrected rows, used if data is nullptr
+     * @param [out] zeros if corrected rows contain zero weights
+     * @return if any row was modified
+     *
+     * Policy::correct_row( weights, missing, N, corrected, zeros ) re-weights a single row of N entries, and
+     * returns if the row was modified. It must read all weights before writing any corrected weight, as
+     * these may alias.
+     */
+    template <typename T, typename Policy>
+    static bool reweight( const Matrix& W, const Field& field, Scalar* data, Corrections* corrections,
+                         bool& zeros ) {
         field::MissingValue mv( field );
         auto& missingValue = mv.ref();
 
@@ -39,125 +53,164 @@ struct MissingIfAllMissing : Missing {
         auto values = make_view_field_values<T, 1>( field );
         ATLAS_ASSERT( idx_t( W.cols() ) == values.size() );
 
-        auto data  = const_cast<Scalar*>( W.data() );
-        bool modif = false;
-        bool zeros = false;
+        const auto outer   = W.outer();
+        const auto inner   = W.inner();
+        const auto weights = W.data();
 
-        Size i = 0;
-        Matrix::iterator it( W );
+        std::vector<char> missing;
+        std::vector<Scalar> corrected;
+
+        bool modif = false;
+        zeros      = false;
         for ( Size r = 0; r < W.rows(); ++r ) {
-            const Matrix::iterator end = W.end( r );
-
-            // count missing values, accumulate weights (disregarding missing values)
-            size_t i_missing = i;
-            size_t N_missing = 0;
-            size_t N_entries = 0;
-            Scalar sum       = 0.;
-
-            Matrix::iterator kt( it );
-            Size k = i;
-            for ( ; it != end; ++it, ++i, ++N_entries ) {
-                const bool miss = missingValue( values[it.col()] );
-
-                if ( miss ) {
-                    ++N_missing;
-                    i_missing = i;
-                }
-                else {
-                    sum += *it;
-                }
+            const Size k = Size( outer[r] );
+            const Size N = Size( outer[r + 1] - outer[r] );
+
+            missing.resize( N );
+            bool any_missing = false;
+            for ( Size j = 0; j < N; ++j ) {
+                missing[j] = missingValue( values[inner[k + j]] );
+                any_missing |= bool( missing[j] );
+            }
+            if ( !any_missing ) {
+                continue;
             }
 
-            // weights redistribution: zero-weight all missing values, linear re-weighting for the others;
-            // the result is missing value if all values in row are missing
-            if ( N_missing > 0 ) {
-                if ( N_missing == N_entries || eckit::types::is_approximately_equal( sum, 0. ) ) {
-                    for ( Size j = k; j < k + N_entries; ++j ) {
-                        data[j] = j == i_missing ? 1. : 0.;
-                    }
-                }
-                else {
-                    const Scalar factor = 1. / sum;
-                    for ( Size j = k; j < k + N_entries; ++j, ++kt ) {
-                        if ( missingValue( values[kt.col()] ) ) {
-                            data[j] = 0.;
-                            zeros   = true;
-                        }
-                        else {
-                            data[j] *= factor;
+            bool row_zeros = false;
+            if ( data != nullptr ) {
+                modif |= Policy::correct_row( weights + k, missing.data(), N, data + k, row_zeros );
+                zeros |= row_zeros;
+            }
+            else {
+                corrected.resize( N );
+                if ( Policy::correct_row( weights + k, missing.data(), N, corrected.data(), row_zeros ) ) {
+                    // zero weights only need to be kept if they cannot multiply a not-a-number
+                    const bool prune = row_zeros && missingValue.isnan();
+                    corrections->rows.push_back( r );
+                    for ( Size j = 0; j < N; ++j ) {
+                        if ( !( prune && corrected[j] == 0. ) ) {
+                            corrections->inner.push_back( Size( inner[k + j] ) );
+                            corrections->data.push_back( corrected[j] );
                         }
                     }
+                    corrections->outer.push_back( corrections->inner.size() );
+                    zeros |= row_zeros;
+                    modif = true;
                 }
-                modif = true;
             }
         }
+        return modif;
+    }
 
-        if ( zeros && missingValue.isnan() ) {
+    template <typename T, typename Policy>
+    static bool correct_matrix( Matrix& W, const Field& field ) {
+        bool zeros       = false;
+        const bool modif = reweight<T, Policy>( W, field, const_cast<Scalar*>( W.data() ), nullptr, zeros );
+        if ( zeros && field::MissingValue( field ).isnan() ) {
             W.prune( 0. );
         }
-
         return modif;
     }
 
-    static std::string static_type() { return "missing-if-all-missing"; }
+    template <typename T, typename Policy>
+    static bool correct_rows( const Matrix& W, const Field& field, Corrections& corrections ) {
+        bool zeros = false;
+        corrections.clear();
+        return reweight<T, Policy>( W, field, nullptr, &corrections, zeros );
+    }
 };
 
 
 template <typename T>
-struct MissingIfAnyMissing : Missing {
-    bool execute( NonLinear::Matrix& W, const Field& field ) const {
-        field::MissingValue mv( field );
-        auto& missingValue = mv.ref();
-
-        // NOTE only for scalars (for now)
-        auto values = make_view_field_values<T, 1>( field );
-        ATLAS_ASSERT( idx_t( W.cols() ) == values.size() );
-
-        auto data  = const_cast<Scalar*>( W.data() );
-        bool modif = false;
-        bool zeros = false;
+struct MissingIfAllMissing : Missing {
+    bool execute( NonLinear::Matrix& W, const Field& field ) const override {
+        return correct_matrix<T, MissingIfAllMissing>( W, field );
+    }
 
-        Size i = 0;
-        Matrix::iterator it( W );
-        for ( Size r = 0; r < W.rows(); ++r ) {
-            const Matrix::iterator end = W.end( r );
+    bool execute( const NonLinear::Matrix& W, const Field& field, Corrections& corrections ) const override {
+        return correct_rows<T, MissingIfAllMissing>( W, field, corrections );
+    }
 
-            // count missing values, accumulate weights (disregarding missing values)
-            size_t i_missing = i;
-            size_t N_missing = 0;
-            size_t N_entries = 0;
+    // weights redistribution: zero-weight all missing values, linear re-weighting for the others;
+    // the result is missing value if all values in row are missing
+    static bool correct_row( const Scalar* weights, const char* missing, Size N, Scalar* corrected, bool& zeros ) {
+        // count missing values, accumulate weights (disregarding missing values)
+        Size i_missing = 0;
+        Size N_missing = 0;
+        Scalar sum     = 0.;
+        for ( Size j = 0; j < N; ++j ) {
+            if ( missing[j] ) {
+                ++N_missing;
+                i_missing = j;
+            }
+            else {
+                sum += weights[j];
+            }
+        }
 
-            Matrix::iterator kt( it );
-            Size k = i;
-            for ( ; it != end; ++it, ++i, ++N_entries ) {
-                const bool miss = missingValue( values[it.col()] );
+        if ( N_missing == 0 ) {
+            return false;
+        }
 
-                if ( miss ) {
-                    ++N_missing;
-                    i_missing = i;
+        if ( N_missing == N || eckit::types::is_approximately_equal( sum, 0. ) ) {
+            for ( Size j = 0; j < N; ++j ) {
+                corrected[j] = j == i_missing ? 1. : 0.;
+            }
+        }
+        else {
+            const Scalar factor = 1. / sum;
+            for ( Size j = 0; j < N; ++j ) {
+                if ( missing[j] ) {
+                    corrected[j] = 0.;
+                    zeros        = true;
+                }
+                else {
+                    corrected[j] = weights[j] * factor;
                 }
             }
+        }
+        return true;
+    }
 
-            // if any values in row are missing, force missing value
-            if ( N_missing > 0 ) {
-                for ( Size j = k; j < k + N_entries; ++j ) {
-                    if ( j == i_missing ) {
-                        data[j] = 1.;
-                    }
-                    else {
-                        data[j] = 0.;
-                        zeros   = true;
-                    }
-                }
-                modif = true;
+    static std::string static_type() { return "missing-if-all-missing"; }
+};
+
+
+template <typename T>
+struct MissingIfAnyMissing : Missing {
+    bool execute( NonLinear::Matrix& W, const Field& field ) const override {
+        return correct_matrix<T, MissingIfAnyMissing>( W, field );
+    }
+
+    bool execute( const NonLinear::Matrix& W, const Field& field, Corrections& corrections ) const override {
+        return correct_rows<T, MissingIfAnyMissing>( W, field, corrections );
+    }
+
+    // if any values in row are missing, force missing value
+    static bool correct_row( const Scalar*, const char* missing, Size N, Scalar* corrected, bool& zeros ) {
+        Size i_missing = 0;
+        Size N_missing = 0;
+        for ( Size j = 0; j < N; ++j ) {
+            if ( missing[j] ) {
+                ++N_missing;
+                i_missing = j;
             }
         }
 
-        if ( zeros && missingValue.isnan() ) {
-            W.prune( 0. );
+        if ( N_missing == 0 ) {
+            return false;
         }
 
-        return modif;
+        for ( Size j = 0; j < N; ++j ) {
+            if ( j == i_missing ) {
+                corrected[j] = 1.;
+            }
+            else {
+                corrected[j] = 0.;
+                zeros        = true;
+            }
+        }
+        return true;
     }
 
     static std::string static_type() { return "missing-if-any-missing"; }
@@ -166,80 +219,60 @@ struct MissingIfAnyMissing : Missing {
 
 template <typename T>
 struct MissingIfHeaviestMissing : Missing {
-    bool execute( NonLinear::Matrix& W, const Field& field ) const {
-        field::MissingValue mv( field );
-        auto& missingValue = mv.ref();
-
-        // NOTE only for scalars (for now)
-        auto values = make_view_field_values<T, 1>( field );
-        ATLAS_ASSERT( idx_t( W.cols() ) == values.size() );
+    bool execute( NonLinear::Matrix& W, const Field& field ) const override {
+        return correct_matrix<T, MissingIfHeaviestMissing>( W, field );
+    }
 
-        auto data  = const_cast<Scalar*>( W.data() );
-        bool modif = false;
-        bool zeros = false;
+    bool execute( const NonLinear::Matrix& W, const Field& field, Corrections& corrections ) const override {
+        return correct_rows<T, MissingIfHeaviestMissing>( W, field, corrections );
+    }
 
-        Size i = 0;
-        Matrix::iterator it( W );
-        for ( Size r = 0; r < W.rows(); ++r ) {
-            const Matrix::iterator end = W.end( r );
-
-            // count missing values, accumulate weights (disregarding missing values) and find maximum weight in row
-            size_t i_missing         = i;
-            size_t N_missing         = 0;
-            size_t N_entries         = 0;
-            Scalar sum               = 0.;
-            Scalar heaviest          = -1.;
-            bool heaviest_is_missing = false;
-
-            Matrix::iterator kt( it );
-            Size k = i;
-            for ( ; it != end; ++it, ++i, ++N_entries ) {
-                const bool miss = missingValue( values[it.col()] );
-
-                if ( miss ) {
-                    ++N_missing;
-                    i_missing = i;
-                }
-                else {
-                    sum += *it;
-                }
+    // weights redistribution: zero-weight all missing values, linear re-weighting for the others;
+    // if all values are missing, or the closest value is missing, force missing value
+    static bool correct_row( const Scalar* weights, const char* missing, Size N, Scalar* corrected, bool& zeros ) {
+        // count missing values, accumulate weights (disregarding missing values) and find maximum weight in row
+        Size i_missing           = 0;
+        Size N_missing           = 0;
+        Scalar sum               = 0.;
+        Scalar heaviest          = -1.;
+        bool heaviest_is_missing = false;
+        for ( Size j = 0; j < N; ++j ) {
+            if ( missing[j] ) {
+                ++N_missing;
+                i_missing = j;
+            }
+            else {
+                sum += weights[j];
+            }
 
-                if ( heaviest < data[i] ) {
-                    heaviest            = data[i];
-                    heaviest_is_missing = miss;
-                }
+            if ( heaviest < weights[j] ) {
+                heaviest            = weights[j];
+                heaviest_is_missing = missing[j];
             }
+        }
 
-            // weights redistribution: zero-weight all missing values, linear re-weighting for the others;
-            // if all values are missing, or the closest value is missing, force missing value
-            if ( N_missing > 0 ) {
-                if ( N_missing == N_entries || heaviest_is_missing ||
-                     eckit::types::is_approximately_equal( sum, 0. ) ) {
-                    for ( Size j = k; j < k + N_entries; ++j ) {
-                        data[j] = j == i_missing ? 1. : 0.;
-                    }
+        if ( N_missing == 0 ) {
+            return false;
+        }
+
+        if ( N_missing == N || heaviest_is_missing || eckit::types::is_approximately_equal( sum, 0. ) ) {
+            for ( Size j = 0; j < N; ++j ) {
+                corrected[j] = j == i_missing ? 1. : 0.;
+            }
+        }
+        else {
+            const Scalar factor = 1. / sum;
+            for ( Size j = 0; j < N; ++j ) {
+                if ( missing[j] ) {
+                    corrected[j] = 0.;
+                    zeros        = true;
                 }
                 else {
-                    const Scalar factor = 1. / sum;
-                    for ( Size j = k; j < k + N_entries; ++j, ++kt ) {
-                        if ( missingValue( values[kt.col()] ) ) {
-                            data[j] = 0.;
-                            zeros   = true;
-                        }
-                        else {
-                            data[j] *= factor;
-                        }
-                    }
+                    corrected[j] = weights[j] * factor;
                 }
-                modif = true;
             }
         }
-
-        if ( zeros && missingValue.isnan() ) {
-            W.prune( 0. );
-        }
-
-        return modif;
+        return true;
     }
 
     static std::string static_type() { return "missing-if-heaviest-missing"; }
@@ -18,6 +18,47 @@ namespace interpolation {
 namespace nonlinear {
 
 
+void NonLinear::Corrections::clear() {
+    rows.clear();
+    outer.assign( 1, 0 );
+    inner.clear();
+    data.clear();
+}
+
+
+bool NonLinear::execute( const Matrix& W, const Field& f, Corrections& corrections ) const {
+    corrections.clear();
+
+    Matrix M( W );
+    if ( !execute( M, f ) ) {
+        return false;
+    }
+
+    // record rows of M that differ from W
+    const auto W_outer = W.outer();
+    const auto W_inner = W.inner();
+    const auto W_data  = W.data();
+    const auto M_outer = M.outer();
+    const auto M_inner = M.inner();
+    const auto M_data  = M.data();
+    for ( Size r = 0; r < W.rows(); ++r ) {
+        bool same = ( W_outer[r + 1] - W_outer[r] ) == ( M_outer[r + 1] - M_outer[r] );
+        for ( auto w = W_outer[r], m = M_outer[r]; same && m < M_outer[r + 1]; ++w, ++m ) {
+            same = W_inner[w] == M_inner[m] && W_data[w] == M_data[m];
+        }
+        if ( !same ) {
+            corrections.rows.push_back( r );
+            for ( auto m = M_outer[r]; m < M_outer[r + 1]; ++m ) {
+                corrections.inner.push_back( Size( M_inner[m] ) );
+                corrections.data.push_back( M_data[m] );
+            }
+            corrections.outer.push_back( corrections.inner.size() );
+        }
+    }
+    return !corrections.empty();
+}
+
+
 const NonLinear* NonLinearFactory::build( const std::string& builder, const NonLinearFactory::Config& config ) {
     return get( builder )->make( config );
 }
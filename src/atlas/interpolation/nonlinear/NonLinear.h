@@ -14,6 +14,7 @@
 
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "eckit/config/Parametrisation.h"
 #include "eckit/linalg/SparseMatrix.h"
@@ -41,6 +42,19 @@ public:
     using Scalar = eckit::linalg::Scalar;
     using Size   = eckit::linalg::Size;
 
+    /**
+     * @brief Rows replacing the corresponding rows of an interpolation matrix, in compressed sparse row format
+     */
+    struct Corrections {
+        std::vector<Size> rows;      ///< indices of corrected rows, in increasing order
+        std::vector<Size> outer{0};  ///< offsets of each corrected row in inner/data (size rows.size()+1)
+        std::vector<Size> inner;     ///< column indices
+        std::vector<Scalar> data;    ///< weights
+
+        bool empty() const { return rows.empty(); }
+        void clear();
+    };
+
     /**
      * @brief ctor
      */
@@ -66,6 +80,16 @@ public:
      */
     virtual bool execute( Matrix& W, const Field& f ) const = 0;
 
+    /**
+     * @brief Compute non-linear corrections to interpolation matrix, without modifying it
+     * @note the default implementation applies the corrections to a copy of W, derived classes should do better
+     * @param [in] W interpolation matrix
+     * @param [in] f field with missing values information
+     * @param [out] corrections rows replacing rows of W
+     * @return if any row of W needs correcting
+     */
+    virtual bool execute( const Matrix& W, const Field& f, Corrections& corrections ) const;
+
 protected:
     template <typename Value, int Rank>
     static array::ArrayView<typename std::add_const<Value>::type, Rank> make_view_field_values( const Field& field ) {
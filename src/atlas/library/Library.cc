@@ -43,6 +43,10 @@
 #include "transi/version.h"
 #endif
 
+#if !ATLAS_HAVE_GRIDTOOLS_STORAGE
+#include "atlas/array/native/NativeDataStore.h"
+#endif
+
 using eckit::LocalPathName;
 using eckit::Main;
 using eckit::PathName;
@@ -216,6 +220,17 @@ void Library::initialise( const eckit::Parametrisation& config ) {
         config.get( "trace.barriers", trace_barriers_ );
         config.get( "trace.report", trace_report_ );
     }
+#if !ATLAS_HAVE_GRIDTOOLS_STORAGE
+    if ( config.has( "memory" ) ) {
+        bool memory_pool = array::native::MemoryPool::instance().enabled();
+        config.get( "memory.pool", memory_pool );
+        array::native::MemoryPool::instance().enable( memory_pool );
+        long max_cached;
+        if ( config.get( "memory.pool_max_cached", max_cached ) ) {
+            array::native::MemoryPool::instance().max_cached( size_t( max_cached ) );
+        }
+    }
+#endif
 
     if ( not debug_ ) {
         debug_channel_.reset();
@@ -307,6 +322,9 @@ void Library::initialise( const eckit::Parametrisation& config ) {
         out << "  log.debug       [" << str( debug() ) << "] \n";
         out << "  trace.barriers  [" << str( traceBarriers() ) << "] \n";
         out << "  trace.report    [" << str( trace_report_ ) << "] \n";
+#if !ATLAS_HAVE_GRIDTOOLS_STORAGE
+        out << "  memory.pool     [" << str( array::native::MemoryPool::instance().enabled() ) << "] \n";
+#endif
         out << " \n";
         out << atlas::Library::instance().information();
         out << std::flush;
@@ -328,6 +346,13 @@ void Library::finalise() {
         mpi::finalise();
     }
 
+#if !ATLAS_HAVE_GRIDTOOLS_STORAGE
+    if ( array::native::MemoryPool::instance().enabled() ) {
+        Log::debug() << "Memory: " << array::native::MemoryHighWatermark::instance() << std::endl;
+        array::native::MemoryPool::instance().release();
+    }
+#endif
+
     // Make sure that these specialised channels that wrap Log::info() are
     // destroyed before eckit::Log::info gets destroyed.
     // Just in case someone still tries to log, we reset to empty channels.
@@ -27,6 +27,7 @@
 #include <array>
 #include <cstring>
 #include <initializer_list>
+#include <memory>
 
 #include "atlas/array.h"
 #include "atlas/array/ArrayView.h"
@@ -42,6 +43,14 @@ namespace eckit {
 class Stream;
 }
 
+namespace atlas {
+namespace output {
+namespace detail {
+class MeshIO;
+}
+}  // namespace output
+}  // namespace atlas
+
 namespace atlas {
 namespace mesh {
 
@@ -344,9 +353,13 @@ public:
 
 private:
     friend class ConnectivityPrivateAccess;
+    friend class output::detail::MeshIO;
     ctxt_t ctxt_;
     callback_t callback_update_;
     callback_t callback_delete_;
+
+    // Keeps external memory of non-owned tables alive, e.g. a memory-mapped file
+    std::shared_ptr<const void> external_storage_;
 };
 
 // ----------------------------------------------------------------------------------------------
@@ -484,6 +497,7 @@ protected:
     }
 
 private:
+    friend class output::detail::MeshIO;
     void rebuild_block_connectivity();
 
 private:
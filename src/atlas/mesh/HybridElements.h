@@ -55,6 +55,14 @@ using MultiBlockConnectivity = ConnectivityInterface<MultiBlockConnectivityImpl>
 }  // namespace mesh
 }  // namespace atlas
 
+namespace atlas {
+namespace output {
+namespace detail {
+class MeshIO;
+}
+}  // namespace output
+}  // namespace atlas
+
 namespace atlas {
 namespace mesh {
 
@@ -63,6 +71,7 @@ namespace mesh {
 /// @brief HybridElements class that describes elements of different types
 class HybridElements : public util::Object {
     friend class Elements;
+    friend class output::detail::MeshIO;
 
 public:
     typedef MultiBlockConnectivity Connectivity;
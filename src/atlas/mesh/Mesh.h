@@ -46,6 +46,14 @@ class MeshGeneratorImpl;
 }
 }  // namespace atlas
 
+namespace atlas {
+namespace output {
+namespace detail {
+class MeshIO;
+}
+}  // namespace output
+}  // namespace atlas
+
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace atlas {
@@ -134,6 +142,7 @@ private:  // methods
     }
 
     friend class meshgenerator::MeshGeneratorImpl;
+    friend class output::detail::MeshIO;
     void setProjection( const Projection& p ) { get()->setProjection( p ); }
     void setGrid( const Grid& p ) { get()->setGrid( p ); }
 };
@@ -33,6 +33,14 @@ using IrregularConnectivity = ConnectivityInterface<IrregularConnectivityImpl>;
 }  // namespace mesh
 }  // namespace atlas
 
+namespace atlas {
+namespace output {
+namespace detail {
+class MeshIO;
+}
+}  // namespace output
+}  // namespace atlas
+
 namespace atlas {
 namespace mesh {
 
@@ -126,6 +134,8 @@ public:  // methods
 private:
     void print( std::ostream& ) const;
 
+    friend class output::detail::MeshIO;
+
     friend std::ostream& operator<<( std::ostream& s, const Nodes& p ) {
         p.print( s );
         return s;
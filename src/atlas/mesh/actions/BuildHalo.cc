@@ -12,7 +12,6 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
-#include <numeric>
 #include <stdexcept>
 
 #include "atlas/array.h"
@@ -26,6 +25,7 @@
 #include "atlas/mesh/actions/BuildHalo.h"
 #include "atlas/mesh/actions/BuildParallelFields.h"
 #include "atlas/mesh/detail/AccumulateFacets.h"
+#include "atlas/mesh/detail/RenumberGlobalIndex.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
@@ -58,16 +58,6 @@ namespace atlas {
 namespace mesh {
 namespace actions {
 
-struct Entity {
-    Entity( gidx_t gid, idx_t idx ) {
-        g = gid;
-        i = idx;
-    }
-    gidx_t g;
-    idx_t i;
-    bool operator<( const Entity& other ) const { return ( g < other.g ); }
-};
-
 void make_nodes_global_index_human_readable( const mesh::actions::BuildHalo& build_halo, mesh::Nodes& nodes,
                                              bool do_all ) {
     ATLAS_TRACE();
@@ -76,10 +66,6 @@ void make_nodes_global_index_human_readable( const mesh::actions::BuildHalo& bui
     // uid,
     //     and could receive different gidx for different tasks
 
-    // unused // int mypart = mpi::rank();
-    int nparts  = mpi::size();
-    size_t root = 0;
-
     array::ArrayView<gidx_t, 1> nodes_glb_idx = array::make_view<gidx_t, 1>( nodes.global_index() );
     // nodes_glb_idx.dump( Log::info() );
     //  ATLAS_DEBUG( "min = " << nodes.global_index().metadata().getLong("min") );
@@ -129,50 +115,8 @@ void make_nodes_global_index_human_readable( const mesh::actions::BuildHalo& bui
     //    }
     //  }
 
-    // 1) Gather all global indices, together with location
-
-    std::vector<int> recvcounts( mpi::size() );
-    std::vector<int> recvdispls( mpi::size() );
-
-    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( nb_nodes, recvcounts, root ); }
-    idx_t glb_nb_nodes = std::accumulate( recvcounts.begin(), recvcounts.end(), 0 );
-
-    recvdispls[0] = 0;
-    for ( int jpart = 1; jpart < nparts; ++jpart ) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-
-    std::vector<gidx_t> glb_idx_gathered( glb_nb_nodes );
-    ATLAS_TRACE_MPI( GATHER ) {
-        mpi::comm().gatherv( glb_idx.data(), glb_idx.size(), glb_idx_gathered.data(), recvcounts.data(),
-                             recvdispls.data(), root );
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Entity> node_sort;
-    node_sort.reserve( glb_nb_nodes );
-    const idx_t nb_glb_idx_gathered = static_cast<idx_t>( glb_idx_gathered.size() );
-    for ( idx_t jnode = 0; jnode < nb_glb_idx_gathered; ++jnode ) {
-        node_sort.emplace_back( glb_idx_gathered[jnode], jnode );
-    }
-
-    ATLAS_TRACE_SCOPE( "sort on rank 0" ) { std::sort( node_sort.begin(), node_sort.end() ); }
-
-    gidx_t gid               = glb_idx_max + 1;
-    const idx_t nb_node_sort = static_cast<idx_t>( node_sort.size() );
-    for ( idx_t jnode = 0; jnode < nb_node_sort; ++jnode ) {
-        if ( jnode > 0 && node_sort[jnode].g != node_sort[jnode - 1].g ) {
-            ++gid;
-        }
-        int inode               = node_sort[jnode].i;
-        glb_idx_gathered[inode] = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI( SCATTER ) {
-        mpi::comm().scatterv( glb_idx_gathered.data(), recvcounts.data(), recvdispls.data(), glb_idx.data(),
-                              static_cast<int>( glb_idx.size() ), root );
-    }
+    // Renumber global indices from glb_idx_max+1, following the order of the original global indices
+    mesh::detail::renumber_global_index( glb_idx, glb_idx_max );
 
     for ( int jnode = 0; jnode < nb_nodes; ++jnode ) {
         nodes_glb_idx( points_to_edit[jnode] ) = glb_idx[jnode];
@@ -189,9 +133,6 @@ void make_cells_global_index_human_readable( const mesh::actions::BuildHalo& bui
                                              bool do_all ) {
     ATLAS_TRACE();
 
-    int nparts = static_cast<idx_t>( mpi::size() );
-    idx_t root = 0;
-
     array::ArrayView<gidx_t, 1> cells_glb_idx = array::make_view<gidx_t, 1>( cells.global_index() );
     //  ATLAS_DEBUG( "min = " << cells.global_index().metadata().getLong("min") );
     //  ATLAS_DEBUG( "max = " << cells.global_index().metadata().getLong("max") );
@@ -230,48 +171,8 @@ void make_cells_global_index_human_readable( const mesh::actions::BuildHalo& bui
         glb_idx[i] = cells_glb_idx( cells_to_edit[i] );
     }
 
-    // 1) Gather all global indices, together with location
-
-    std::vector<int> recvcounts( mpi::size() );
-    std::vector<int> recvdispls( mpi::size() );
-
-    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( nb_cells, recvcounts, root ); }
-    idx_t glb_nb_cells = std::accumulate( recvcounts.begin(), recvcounts.end(), 0 );
-
-    recvdispls[0] = 0;
-    for ( int jpart = 1; jpart < nparts; ++jpart ) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-
-    std::vector<gidx_t> glb_idx_gathered( glb_nb_cells );
-    ATLAS_TRACE_MPI( GATHER ) {
-        mpi::comm().gatherv( glb_idx.data(), glb_idx.size(), glb_idx_gathered.data(), recvcounts.data(),
-                             recvdispls.data(), root );
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Entity> cell_sort;
-    cell_sort.reserve( glb_nb_cells );
-    for ( idx_t jcell = 0; jcell < glb_nb_cells; ++jcell ) {
-        cell_sort.emplace_back( glb_idx_gathered[jcell], jcell );
-    }
-
-    ATLAS_TRACE_SCOPE( "sort on rank 0" ) { std::sort( cell_sort.begin(), cell_sort.end() ); }
-
-    gidx_t gid = glb_idx_max + 1;
-    for ( idx_t jcell = 0; jcell < glb_nb_cells; ++jcell ) {
-        if ( jcell > 0 && cell_sort[jcell].g != cell_sort[jcell - 1].g ) {
-            ++gid;
-        }
-        idx_t icell             = cell_sort[jcell].i;
-        glb_idx_gathered[icell] = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI( SCATTER ) {
-        mpi::comm().scatterv( glb_idx_gathered.data(), recvcounts.data(), recvdispls.data(), glb_idx.data(),
-                              static_cast<int>( glb_idx.size() ), root );
-    }
+    // Renumber global indices from glb_idx_max+1, following the order of the original global indices
+    mesh::detail::renumber_global_index( glb_idx, glb_idx_max );
 
     for ( int jcell = 0; jcell < nb_cells; ++jcell ) {
         cells_glb_idx( cells_to_edit[jcell] ) = glb_idx[jcell];
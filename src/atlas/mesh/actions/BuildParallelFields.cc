@@ -21,6 +21,7 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildParallelFields.h"
+#include "atlas/mesh/detail/RenumberGlobalIndex.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
@@ -75,20 +76,6 @@ Field& build_edges_global_idx( Mesh& mesh );
 
 using uid_t = gidx_t;
 
-namespace {
-
-struct Node {
-    Node( gidx_t gid, idx_t idx ) {
-        g = gid;
-        i = idx;
-    }
-    gidx_t g;
-    idx_t i;
-    bool operator<( const Node& other ) const { return ( g < other.g ); }
-};
-
-}  // namespace
-
 //----------------------------------------------------------------------------------------------------------------------
 
 void build_parallel_fields( Mesh& mesh ) {
@@ -158,10 +145,6 @@ void renumber_nodes_glb_idx( mesh::Nodes& nodes ) {
 
     UniqueLonLat compute_uid( nodes );
 
-    // unused // int mypart = mpi::rank();
-    int nparts = mpi::size();
-    idx_t root = 0;
-
     array::ArrayView<gidx_t, 1> glb_idx = array::make_view<gidx_t, 1>( nodes.global_index() );
 
     /*
@@ -177,63 +160,16 @@ void renumber_nodes_glb_idx( mesh::Nodes& nodes ) {
         }
     }
 
-    // 1) Gather all global indices, together with location
-    array::ArrayT<uid_t> loc_id_arr( nb_nodes );
-    array::ArrayView<uid_t, 1> loc_id = array::make_view<uid_t, 1>( loc_id_arr );
-
+    // Renumber global indices from 1, following the order of the unique identifiers
+    std::vector<uid_t> uid( nb_nodes );
     for ( int jnode = 0; jnode < nb_nodes; ++jnode ) {
-        loc_id( jnode ) = glb_idx( jnode );
-    }
-
-    std::vector<int> recvcounts( mpi::size() );
-    std::vector<int> recvdispls( mpi::size() );
-
-    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( nb_nodes, recvcounts, root ); }
-
-    recvdispls[0] = 0;
-    for ( int jpart = 1; jpart < nparts; ++jpart ) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-    int glb_nb_nodes = std::accumulate( recvcounts.begin(), recvcounts.end(), 0 );
-
-    array::ArrayT<uid_t> glb_id_arr( glb_nb_nodes );
-    array::ArrayView<uid_t, 1> glb_id = array::make_view<uid_t, 1>( glb_id_arr );
-
-    ATLAS_TRACE_MPI( GATHER ) {
-        mpi::comm().gatherv( loc_id.data(), loc_id.size(), glb_id.data(), recvcounts.data(), recvdispls.data(), root );
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Node> node_sort;
-    node_sort.reserve( glb_nb_nodes );
-    ATLAS_TRACE_SCOPE( "sort global indices" ) {
-        for ( idx_t jnode = 0; jnode < glb_id.shape( 0 ); ++jnode ) {
-            node_sort.emplace_back( glb_id( jnode ), jnode );
-        }
-        std::sort( node_sort.begin(), node_sort.end() );
-    }
-
-    // Assume edge gid start
-    uid_t gid                   = 0;
-    const idx_t nb_sorted_nodes = static_cast<idx_t>( node_sort.size() );
-    for ( idx_t jnode = 0; jnode < nb_sorted_nodes; ++jnode ) {
-        if ( jnode == 0 ) {
-            ++gid;
-        }
-        else if ( node_sort[jnode].g != node_sort[jnode - 1].g ) {
-            ++gid;
-        }
-        idx_t inode     = node_sort[jnode].i;
-        glb_id( inode ) = gid;
+        uid[jnode] = glb_idx( jnode );
     }
 
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI( SCATTER ) {
-        mpi::comm().scatterv( glb_id.data(), recvcounts.data(), recvdispls.data(), loc_id.data(), loc_id.size(), root );
-    }
+    detail::renumber_global_index( uid );
 
     for ( int jnode = 0; jnode < nb_nodes; ++jnode ) {
-        glb_idx( jnode ) = loc_id( jnode );
+        glb_idx( jnode ) = uid[jnode];
     }
     nodes.global_index().metadata().set( "human_readable", true );
 }
@@ -883,9 +819,6 @@ Field& build_edges_global_idx( Mesh& mesh ) {
 
     UniqueLonLat compute_uid( mesh );
 
-    int nparts = mpi::size();
-    idx_t root = 0;
-
     mesh::HybridElements& edges = mesh.edges();
 
     array::make_view<gidx_t, 1>( edges.global_index() ).assign( -1 );
@@ -921,63 +854,16 @@ Field& build_edges_global_idx( Mesh& mesh ) {
  * REMOTE INDEX BASE = 1
  */
 
-    // 1) Gather all global indices, together with location
-    array::ArrayT<uid_t> loc_edge_id_arr( nb_edges );
-    array::ArrayView<uid_t, 1> loc_edge_id = array::make_view<uid_t, 1>( loc_edge_id_arr );
-
+    // Renumber global indices from 1, following the order of the unique identifiers
+    std::vector<uid_t> uid( nb_edges );
     for ( int jedge = 0; jedge < nb_edges; ++jedge ) {
-        loc_edge_id( jedge ) = edge_gidx( jedge );
-    }
-
-    std::vector<int> recvcounts( mpi::size() );
-    std::vector<int> recvdispls( mpi::size() );
-
-    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( nb_edges, recvcounts, root ); }
-
-    recvdispls[0] = 0;
-    for ( int jpart = 1; jpart < nparts; ++jpart )  // start at 1
-    {
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
+        uid[jedge] = edge_gidx( jedge );
     }
-    int glb_nb_edges = std::accumulate( recvcounts.begin(), recvcounts.end(), 0 );
-
-    array::ArrayT<uid_t> glb_edge_id_arr( glb_nb_edges );
-    array::ArrayView<uid_t, 1> glb_edge_id = array::make_view<uid_t, 1>( glb_edge_id_arr );
 
-    ATLAS_TRACE_MPI( GATHER ) {
-        mpi::comm().gatherv( loc_edge_id.data(), loc_edge_id.size(), glb_edge_id.data(), recvcounts.data(),
-                             recvdispls.data(), root );
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Node> edge_sort;
-    edge_sort.reserve( glb_nb_edges );
-    for ( idx_t jedge = 0; jedge < glb_edge_id.shape( 0 ); ++jedge ) {
-        edge_sort.emplace_back( Node( glb_edge_id( jedge ), jedge ) );
-    }
-    std::sort( edge_sort.begin(), edge_sort.end() );
-
-    // Assume edge gid start
-    uid_t gid( 0 );
-    for ( size_t jedge = 0; jedge < edge_sort.size(); ++jedge ) {
-        if ( jedge == 0 ) {
-            ++gid;
-        }
-        else if ( edge_sort[jedge].g != edge_sort[jedge - 1].g ) {
-            ++gid;
-        }
-        int iedge            = edge_sort[jedge].i;
-        glb_edge_id( iedge ) = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI( SCATTER ) {
-        mpi::comm().scatterv( glb_edge_id.data(), recvcounts.data(), recvdispls.data(), loc_edge_id.data(),
-                              loc_edge_id.size(), root );
-    }
+    detail::renumber_global_index( uid );
 
     for ( int jedge = 0; jedge < nb_edges; ++jedge ) {
-        edge_gidx( jedge ) = loc_edge_id( jedge );
+        edge_gidx( jedge ) = uid[jedge];
     }
 
     return edges.global_index();
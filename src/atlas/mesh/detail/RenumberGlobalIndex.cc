@@ -0,0 +1,128 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/mesh/detail/RenumberGlobalIndex.h"
+
+#include <algorithm>
+
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace mesh {
+namespace detail {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+gidx_t renumber_global_index( std::vector<gidx_t>& uid, gidx_t base ) {
+    ATLAS_TRACE();
+    const auto& comm   = mpi::comm();
+    const idx_t nparts = static_cast<idx_t>( comm.size() );
+    const idx_t mypart = static_cast<idx_t>( comm.rank() );
+
+    // 1) Sorted distinct local identifiers
+    std::vector<gidx_t> local( uid );
+    ATLAS_TRACE_SCOPE( "sort local identifiers" ) {
+        std::sort( local.begin(), local.end() );
+        local.erase( std::unique( local.begin(), local.end() ), local.end() );
+    }
+
+    // 2) Splitters dividing the range of identifiers over the tasks, chosen from regular samples of the
+    //    sorted local identifiers of all tasks. The number of samples per task is limited, so that the
+    //    gathered samples remain small for large numbers of tasks.
+    std::vector<gidx_t> splitters;
+    if ( nparts > 1 ) {
+        const idx_t nb_samples = local.empty() ? 0 : std::min<idx_t>( nparts, 64 );
+        std::vector<gidx_t> samples;
+        samples.reserve( nb_samples );
+        for ( idx_t j = 0; j < nb_samples; ++j ) {
+            samples.push_back( local[( size_t( j ) * local.size() ) / size_t( nb_samples )] );
+        }
+        eckit::mpi::Buffer<gidx_t> recv_samples( nparts );
+        ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( samples.begin(), samples.end(), recv_samples ); }
+        std::vector<gidx_t> all_samples( recv_samples.buffer.begin(), recv_samples.buffer.end() );
+        std::sort( all_samples.begin(), all_samples.end() );
+        if ( not all_samples.empty() ) {
+            splitters.reserve( nparts - 1 );
+            for ( idx_t jpart = 1; jpart < nparts; ++jpart ) {
+                splitters.push_back( all_samples[( size_t( jpart ) * all_samples.size() ) / size_t( nparts )] );
+            }
+        }
+    }
+
+    // 3) Send each identifier to the task responsible for its range; equal identifiers end up on the same task.
+    //    As the local identifiers are sorted, they are sent in contiguous chunks of increasing task.
+    std::vector<std::vector<gidx_t>> send_uid( nparts );
+    std::vector<std::vector<gidx_t>> recv_uid( nparts );
+    {
+        idx_t jpart = 0;
+        for ( gidx_t u : local ) {
+            while ( jpart < static_cast<idx_t>( splitters.size() ) && u >= splitters[jpart] ) {
+                ++jpart;
+            }
+            send_uid[jpart].push_back( u );
+        }
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( send_uid, recv_uid ); }
+
+    // 4) Number the distinct identifiers within the range of this task, offset by the ranges of previous tasks
+    std::vector<gidx_t> range;
+    for ( const auto& r : recv_uid ) {
+        range.insert( range.end(), r.begin(), r.end() );
+    }
+    ATLAS_TRACE_SCOPE( "sort identifiers in range" ) {
+        std::sort( range.begin(), range.end() );
+        range.erase( std::unique( range.begin(), range.end() ), range.end() );
+    }
+    std::vector<gidx_t> range_sizes( nparts );
+    ATLAS_TRACE_MPI( ALLGATHER ) {
+        comm.allGather( static_cast<gidx_t>( range.size() ), range_sizes.begin(), range_sizes.end() );
+    }
+    gidx_t offset = base;
+    gidx_t max    = base;
+    for ( idx_t jpart = 0; jpart < nparts; ++jpart ) {
+        if ( jpart < mypart ) {
+            offset += range_sizes[jpart];
+        }
+        max += range_sizes[jpart];
+    }
+
+    // 5) Return the global indices to the tasks which sent the identifiers, in the same order
+    std::vector<std::vector<gidx_t>> send_gidx( nparts );
+    std::vector<std::vector<gidx_t>> recv_gidx( nparts );
+    for ( idx_t jpart = 0; jpart < nparts; ++jpart ) {
+        send_gidx[jpart].reserve( recv_uid[jpart].size() );
+        for ( gidx_t u : recv_uid[jpart] ) {
+            auto it = std::lower_bound( range.begin(), range.end(), u );
+            send_gidx[jpart].push_back( offset + 1 + ( it - range.begin() ) );
+        }
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( send_gidx, recv_gidx ); }
+
+    // 6) The received global indices are in the order of the sorted distinct local identifiers
+    std::vector<gidx_t> local_gidx;
+    local_gidx.reserve( local.size() );
+    for ( idx_t jpart = 0; jpart < nparts; ++jpart ) {
+        ATLAS_ASSERT( recv_gidx[jpart].size() == send_uid[jpart].size() );
+        local_gidx.insert( local_gidx.end(), recv_gidx[jpart].begin(), recv_gidx[jpart].end() );
+    }
+    for ( auto& u : uid ) {
+        auto it = std::lower_bound( local.begin(), local.end(), u );
+        u       = local_gidx[it - local.begin()];
+    }
+    return max;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace mesh
+}  // namespace atlas
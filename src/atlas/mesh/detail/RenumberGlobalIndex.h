@@ -0,0 +1,39 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/library/config.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace atlas {
+namespace mesh {
+namespace detail {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// @brief Replace unique identifiers, distributed over all MPI tasks, by a contiguous global numbering
+///
+/// Equal identifiers (also on different tasks) receive equal global indices. The global indices follow the
+/// sorted order of the identifiers, and start at base+1.
+/// This is a collective operation, implemented as a parallel sample sort, so that memory and work per task are
+/// proportional to the number of local identifiers rather than to the global number of identifiers.
+///
+/// @return the largest global index, on all tasks
+gidx_t renumber_global_index( std::vector<gidx_t>& uid, gidx_t base = 0 );
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace mesh
+}  // namespace atlas
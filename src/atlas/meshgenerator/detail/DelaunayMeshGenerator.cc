@@ -82,22 +82,12 @@ void DelaunayMeshGenerator::createNodes( const Grid& grid, Mesh& mesh ) const {
     auto ghost  = array::make_view<int, 1>( mesh.nodes().ghost() );
     auto gidx   = array::make_view<gidx_t, 1>( mesh.nodes().global_index() );
 
-    size_t jnode{0};
-    Projection projection = grid.projection();
-    PointLonLat Pll;
-    for ( PointXY Pxy : grid.xy() ) {
-        xy( jnode, size_t( XX ) ) = Pxy.x();
-        xy( jnode, size_t( YY ) ) = Pxy.y();
-
-        Pll                            = projection.lonlat( Pxy );
-        lonlat( jnode, size_t( LON ) ) = Pll.lon();
-        lonlat( jnode, size_t( LAT ) ) = Pll.lat();
+    grid.xy().fill( 0, nb_nodes, xy.data() );
+    grid.projection().xy2lonlat( xy.data(), lonlat.data(), nb_nodes );
 
+    for ( idx_t jnode = 0; jnode < nb_nodes; ++jnode ) {
         ghost( jnode ) = false;
-
-        gidx( jnode ) = jnode + 1;
-
-        ++jnode;
+        gidx( jnode )  = jnode + 1;
     }
 }
 
@@ -699,11 +699,6 @@ void HealpixMeshGenerator::generate_mesh( const StructuredGrid& grid, const grid
                 xy( inode, LON ) = _xy[LON];
                 xy( inode, LAT ) = _xy[LAT];
 
-                // geographic coordinates by using projection
-                grid.projection().xy2lonlat( _xy );
-                lonlat( inode, LON ) = _xy[LON];
-                lonlat( inode, LAT ) = _xy[LAT];
-
                 part( inode )  = parts_SB[iil];
                 ghost( inode ) = is_ghost_SB[iil];
                 // flags
@@ -720,7 +715,7 @@ void HealpixMeshGenerator::generate_mesh( const StructuredGrid& grid, const grid
 #if DEBUG_OUTPUT_DETAIL
                 std::cout << "[" << mypart << "] : "
                           << "New node \tinode=" << inode << "; iil= " << iil << "; ix=" << ix << "; iy=" << iy
-                          << "; glon=" << lonlat( inode, 0 ) << "; glat=" << lonlat( inode, 1 )
+                          << "; x=" << xy( inode, 0 ) << "; y=" << xy( inode, 1 )
                           << "; glb_idx=" << glb_idx( inode ) << "; loc_idx=" << local_idx_SB[iil] << std::endl;
 #endif
             }
@@ -728,6 +723,9 @@ void HealpixMeshGenerator::generate_mesh( const StructuredGrid& grid, const grid
         }
     }
 
+    // geographic coordinates by using projection
+    grid.projection().xy2lonlat( xy.data(), lonlat.data(), nnodes );
+
     ii = 0;  // index inside SB (surrounding belt)
     for ( iy = iy_min; iy <= iy_max; iy++ ) {
         int nx = latPoints( iy ) + 1;
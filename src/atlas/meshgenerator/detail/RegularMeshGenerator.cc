@@ -473,11 +473,6 @@ void RegularMeshGenerator::generate_mesh( const RegularGrid& rg, const grid::Dis
                 xy( inode, LON ) = _xy[LON];
                 xy( inode, LAT ) = _xy[LAT];
 
-                // geographic coordinates by using projection
-                rg.projection().xy2lonlat( _xy );
-                lonlat( inode, LON ) = _xy[LON];
-                lonlat( inode, LAT ) = _xy[LAT];
-
                 // part
                 part( inode ) = parts_SR[ii];
                 // ghost nodes
@@ -502,7 +497,7 @@ void RegularMeshGenerator::generate_mesh( const RegularGrid& rg, const grid::Dis
                           << "\tinode=" << inode << "; ix_glb=" << ix_glb << "; iy_glb=" << iy_glb
                           << "; glb_idx=" << ii_glb << std::endl;
                 std::cout << "[" << mypart << "] : "
-                          << "\tglon=" << lonlat( inode, 0 ) << "; glat=" << lonlat( inode, 1 )
+                          << "\tx=" << xy( inode, 0 ) << "; y=" << xy( inode, 1 )
                           << "; glb_idx=" << glb_idx( inode ) << std::endl;
 #endif
             }
@@ -510,6 +505,9 @@ void RegularMeshGenerator::generate_mesh( const RegularGrid& rg, const grid::Dis
         }
     }
 
+    // geographic coordinates by using projection
+    rg.projection().xy2lonlat( xy.data(), lonlat.data(), nnodes );
+
     // loop over nodes and define cells
     for ( iy = 0; iy < nyl - 1; iy++ ) {      // don't loop into ghost/periodicity row
         for ( ix = 0; ix < nxl - 1; ix++ ) {  // don't loop into ghost/periodicity column
@@ -1025,12 +1025,6 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                 xy( inode, XX ) = x;
                 xy( inode, YY ) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat( crd );
-                lonlat( inode, LON ) = crd[LON];
-                lonlat( inode, LAT ) = crd[LAT];
-
                 glb_idx( inode ) = n + 1;
                 part( inode )    = distribution.partition( n );
                 ghost( inode )   = 0;
@@ -1071,12 +1065,6 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                 xy( inode, XX ) = x;
                 xy( inode, YY ) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat( crd );
-                lonlat( inode, LON ) = crd[LON];
-                lonlat( inode, LAT ) = crd[LAT];
-
                 glb_idx( inode ) = periodic_glb.at( jlat ) + 1;
                 //#warning TODO: use commented approach
                 //        part(inode)      = parts.at( offset_glb.at(jlat) );
@@ -1119,12 +1107,6 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
         xy( inode, XX ) = x;
         xy( inode, YY ) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat( crd );
-        lonlat( inode, LON ) = crd[LON];
-        lonlat( inode, LAT ) = crd[LAT];
-
         glb_idx( inode ) = periodic_glb.at( rg.ny() - 1 ) + 2;
         part( inode )    = mypart;
         ghost( inode )   = 0;
@@ -1143,12 +1125,6 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
         xy( inode, XX ) = x;
         xy( inode, YY ) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat( crd );
-        lonlat( inode, LON ) = crd[LON];
-        lonlat( inode, LAT ) = crd[LAT];
-
         glb_idx( inode ) = periodic_glb.at( rg.ny() - 1 ) + 3;
         part( inode )    = mypart;
         ghost( inode )   = 0;
@@ -1158,6 +1134,9 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
         ++jnode;
     }
 
+    // geographic coordinates by using projection
+    rg.projection().xy2lonlat( xy.data(), lonlat.data(), nnodes );
+
     mesh.metadata().set<size_t>( "nb_nodes_including_halo[0]", nodes.size() );
     nodes.metadata().set<size_t>( "NbRealPts", size_t( nnodes - nnewnodes ) );
     nodes.metadata().set<size_t>( "NbVirtualPts", size_t( nnewnodes ) );
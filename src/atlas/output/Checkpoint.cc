@@ -0,0 +1,578 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/output/Checkpoint.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/field/State.h"
+#include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/EdgeColumns.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/output/detail/CheckpointFile.h"
+#include "atlas/output/detail/MeshIO.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/Metadata.h"
+
+namespace atlas {
+namespace output {
+
+namespace {
+
+using detail::CheckpointFile;
+using detail::CheckpointFileWriter;
+
+eckit::PathName part_path( const eckit::PathName& path, idx_t part ) {
+    return path / ( "part-" + std::to_string( part ) );
+}
+
+eckit::PathName mesh_path( const eckit::PathName& path, idx_t part ) {
+    return path / ( "mesh-" + std::to_string( part ) );
+}
+
+//-----------------------------------------------------------------------------
+
+// Global index and ownership of the points of a function space
+struct Distribution {
+    std::vector<gidx_t> global_index;
+    std::vector<int> owned;
+};
+
+bool distribution( const FunctionSpace& fs, Distribution& d ) {
+    const int mpi_rank = static_cast<int>( mpi::rank() );
+    auto assign        = [&]( const Field& global_index, const Field& flag, bool flag_is_ghost ) {
+        const idx_t size = fs.size();
+        auto glb         = array::make_view<gidx_t, 1>( global_index );
+        auto f           = array::make_view<int, 1>( flag );
+        d.global_index.resize( size );
+        d.owned.resize( size );
+        for ( idx_t j = 0; j < size; ++j ) {
+            d.global_index[j] = glb( j );
+            d.owned[j]        = flag_is_ghost ? f( j ) == 0 : f( j ) == mpi_rank;
+        }
+    };
+    if ( functionspace::NodeColumns fs_nodes{fs} ) {
+        assign( fs_nodes.nodes().global_index(), fs_nodes.nodes().ghost(), true );
+        return true;
+    }
+    if ( functionspace::StructuredColumns fs_structured{fs} ) {
+        assign( fs_structured.global_index(), fs_structured.ghost(), true );
+        return true;
+    }
+    if ( functionspace::EdgeColumns fs_edges{fs} ) {
+        assign( fs_edges.edges().global_index(), fs_edges.edges().partition(), false );
+        return true;
+    }
+    if ( functionspace::CellColumns fs_cells{fs} ) {
+        assign( fs_cells.cells().global_index(), fs_cells.cells().partition(), false );
+        return true;
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+// Fields, and global index and ownership of their function spaces, in a CheckpointFile
+class FieldsFile {
+public:
+    struct Space {
+        size_t size;
+        const gidx_t* global_index;
+        const int* owned;
+    };
+
+    FieldsFile( const eckit::PathName& path ) : file_( path ) {
+        std::vector<util::Config> spaces;
+        file_.toc().get( "spaces", spaces );
+        for ( const auto& space : spaces ) {
+            const size_t size = static_cast<size_t>( space.getLong( "size" ) );
+            spaces_.emplace_back( Space{size, file_.section<gidx_t>( space.getLong( "global_index" ), size ),
+                                        file_.section<int>( space.getLong( "owned" ), size )} );
+        }
+        std::vector<util::Config> fields;
+        file_.toc().get( "fields", fields );
+        for ( auto& field : fields ) {
+            names_.emplace_back( field.getString( "name" ) );
+            fields_.emplace( names_.back(), field );
+        }
+    }
+
+    idx_t nb_parts() const { return file_.nb_parts(); }
+    idx_t part() const { return file_.part(); }
+    const util::Config& toc() const { return file_.toc(); }
+    const std::vector<std::string>& field_names() const { return names_; }
+
+    const Space& space( long space ) const {
+        ATLAS_ASSERT( space >= 0 && size_t( space ) < spaces_.size() );
+        return spaces_[space];
+    }
+
+    const util::Config& field( const std::string& name ) const {
+        auto it = fields_.find( name );
+        if ( it == fields_.end() ) {
+            throw_Exception( "Field \"" + name + "\" not found in checkpoint file " + file_.path().asString(),
+                             Here() );
+        }
+        return it->second;
+    }
+
+    const char* values( const std::string& name ) const {
+        const auto& record = field( name );
+        return file_.section<char>( record.getLong( "offset" ), static_cast<size_t>( record.getLong( "bytes" ) ) );
+    }
+
+    size_t bytes( const std::string& name ) const { return static_cast<size_t>( field( name ).getLong( "bytes" ) ); }
+
+private:
+    CheckpointFile file_;
+    std::vector<Space> spaces_;
+    std::vector<std::string> names_;
+    std::map<std::string, util::Config> fields_;
+};
+
+//-----------------------------------------------------------------------------
+
+void write_fields( const eckit::PathName& path, const std::vector<Field>& fields, const util::Metadata& metadata ) {
+    ATLAS_TRACE( "Checkpoint::write" );
+    const auto& comm     = mpi::comm();
+    const idx_t mpi_rank = static_cast<idx_t>( comm.rank() );
+    const idx_t mpi_size = static_cast<idx_t>( comm.size() );
+
+    if ( mpi_rank == 0 ) {
+        path.mkdir();
+    }
+
+    CheckpointFileWriter writer;
+    std::vector<Distribution> distributions;
+    distributions.reserve( fields.size() );
+    std::map<const void*, long> space_index;
+    std::vector<util::Config> space_records;
+    std::vector<util::Config> field_records;
+    std::set<std::string> names;
+
+    for ( const auto& field : fields ) {
+        if ( not names.insert( field.name() ).second ) {
+            throw_Exception( "Cannot checkpoint multiple fields named \"" + field.name() + "\"", Here() );
+        }
+        ATLAS_ASSERT( field.contiguous(), "Only contiguous fields can be checkpointed" );
+
+        const FunctionSpace& fs = field.functionspace();
+        long space              = -1;
+        auto found              = space_index.find( fs.get() );
+        if ( found != space_index.end() ) {
+            space = found->second;
+        }
+        else {
+            Distribution d;
+            if ( distribution( fs, d ) ) {
+                space                 = static_cast<long>( space_records.size() );
+                space_index[fs.get()] = space;
+                distributions.emplace_back( std::move( d ) );
+                const auto& dist = distributions.back();
+                util::Config record;
+                record.set( "size", static_cast<long>( dist.global_index.size() ) );
+                record.set( "global_index",
+                            writer.add( dist.global_index.data(), dist.global_index.size() * sizeof( gidx_t ) ) );
+                record.set( "owned", writer.add( dist.owned.data(), dist.owned.size() * sizeof( int ) ) );
+                space_records.emplace_back( record );
+            }
+        }
+        if ( space >= 0 ) {
+            ATLAS_ASSERT( size_t( field.shape( 0 ) ) == distributions[space].global_index.size(),
+                          "First dimension of field \"" + field.name() + "\" does not match its function space" );
+        }
+
+        const size_t bytes = field.size() * field.datatype().size();
+        util::Config record;
+        record.set( "name", field.name() );
+        record.set( "datatype", field.datatype().str() );
+        record.set( "shape", std::vector<long>( field.shape().begin(), field.shape().end() ) );
+        record.set( "space", space );
+        record.set( "offset", writer.add( field.array().storage(), bytes ) );
+        record.set( "bytes", static_cast<long>( bytes ) );
+        record.set( "metadata", eckit::LocalConfiguration( field.metadata() ) );
+        field_records.emplace_back( record );
+    }
+
+    util::Config toc;
+    toc.set( "spaces", space_records );
+    toc.set( "fields", field_records );
+    toc.set( "metadata", eckit::LocalConfiguration( metadata ) );
+
+    // The directory must exist before any task writes to it
+    ATLAS_TRACE_MPI( BARRIER ) { comm.barrier(); }
+
+    writer.write( part_path( path, mpi_rank ), toc, mpi_size, mpi_rank );
+
+    // The checkpoint is complete once all tasks have written their file
+    ATLAS_TRACE_MPI( BARRIER ) { comm.barrier(); }
+}
+
+//-----------------------------------------------------------------------------
+
+// Plan to fill the owned points of a function space with the values of the points of a checkpointed function
+// space; the remaining points are filled with a halo exchange
+struct Redistribution {
+    bool identity{false};
+    bool halo_exchange{false};
+    std::vector<std::vector<std::pair<idx_t, idx_t>>> send;  // per task: (file, point) of the values to send
+    std::vector<std::vector<idx_t>> recv;                    // per task: points receiving the values, in order
+};
+
+class CheckpointReader {
+public:
+    CheckpointReader( const eckit::PathName& path ) :
+        mpi_rank_( static_cast<idx_t>( mpi::comm().rank() ) ), mpi_size_( static_cast<idx_t>( mpi::comm().size() ) ) {
+        ATLAS_TRACE( "Checkpoint::open" );
+        std::shared_ptr<FieldsFile> first( new FieldsFile( part_path( path, 0 ) ) );
+        nb_parts_ = first->nb_parts();
+
+        // Files are distributed round-robin, so that with an unchanged number of tasks each task maps its own file
+        for ( idx_t part = mpi_rank_; part < nb_parts_; part += mpi_size_ ) {
+            files_.emplace_back( part == 0 ? first : std::make_shared<FieldsFile>( part_path( path, part ) ) );
+            if ( files_.back()->part() != part || files_.back()->nb_parts() != nb_parts_ ) {
+                throw_Exception( "Checkpoint file " + part_path( path, part ).asString() +
+                                     " does not belong to checkpoint " + path.asString(),
+                                 Here() );
+            }
+        }
+        toc_ = files_.empty() ? first : files_.front();
+    }
+
+    std::vector<std::string> field_names() const { return toc_->field_names(); }
+
+    void read( Field& field ) {
+        ATLAS_TRACE( "Checkpoint::read " + field.name() );
+        const std::string& name = field.name();
+        const auto& record      = toc_->field( name );
+
+        if ( array::DataType( record.getString( "datatype" ) ) != field.datatype() ) {
+            throw_Exception( "Field \"" + name + "\" was checkpointed with datatype " + record.getString( "datatype" ),
+                             Here() );
+        }
+        std::vector<long> shape;
+        record.get( "shape", shape );
+        bool compatible = shape.size() == size_t( field.rank() );
+        for ( idx_t j = 1; compatible && j < field.rank(); ++j ) {
+            compatible = shape[j] == field.shape( j );
+        }
+        if ( not compatible ) {
+            throw_Exception( "Field \"" + name + "\" was checkpointed with a different shape", Here() );
+        }
+        ATLAS_ASSERT( field.contiguous(), "Only contiguous fields can be read from a checkpoint" );
+
+        const size_t stride = ( field.shape( 0 ) ? field.size() / size_t( field.shape( 0 ) ) : 0 ) *
+                              field.datatype().size();
+        char* target = static_cast<char*>( field.storage() );
+
+        const long space = record.getLong( "space" );
+        if ( space < 0 ) {
+            if ( nb_parts_ != mpi_size_ ) {
+                throw_Exception( "Field \"" + name + "\" has no global index and can only be read by " +
+                                     std::to_string( nb_parts_ ) + " tasks",
+                                 Here() );
+            }
+            copy( name, target, field.shape( 0 ) * stride );
+        }
+        else {
+            const auto& plan = redistribution( space, field.functionspace() );
+            if ( plan.identity ) {
+                copy( name, target, field.shape( 0 ) * stride );
+            }
+            else {
+                exchange( plan, name, target, stride );
+                if ( plan.halo_exchange ) {
+                    field.functionspace().haloExchange( field );
+                    field.set_dirty( false );
+                }
+            }
+        }
+
+        const auto& metadata = record.getSubConfiguration( "metadata" );
+        field.metadata()     = util::Metadata( util::Config( field.metadata() ) | util::Config( metadata ) );
+    }
+
+    void read( util::Metadata& metadata ) const {
+        if ( toc_->toc().has( "metadata" ) ) {
+            metadata = util::Metadata( util::Config( metadata ) |
+                                       util::Config( toc_->toc().getSubConfiguration( "metadata" ) ) );
+        }
+    }
+
+private:
+    void copy( const std::string& name, char* target, size_t bytes ) const {
+        const auto& file = *files_.front();
+        if ( file.bytes( name ) != bytes ) {
+            throw_Exception( "Field \"" + name + "\" was checkpointed with a different size", Here() );
+        }
+        std::memcpy( target, file.values( name ), bytes );
+    }
+
+    const Redistribution& redistribution( long space, const FunctionSpace& fs ) {
+        auto key   = std::make_pair( space, static_cast<const void*>( fs.get() ) );
+        auto found = plans_.find( key );
+        if ( found != plans_.end() ) {
+            return found->second;
+        }
+        ATLAS_TRACE( "Checkpoint::redistribution" );
+        const auto& comm     = mpi::comm();
+        Redistribution& plan = plans_[key];
+
+        Distribution d;
+        if ( not distribution( fs, d ) ) {
+            throw_Exception( "Checkpointed fields can only be read on a function space with global index", Here() );
+        }
+
+        // Same tasks and same points: values are copied straight from the mapped file
+        int identical = 0;
+        if ( nb_parts_ == mpi_size_ ) {
+            const auto& s = files_.front()->space( space );
+            if ( s.size == d.global_index.size() ) {
+                identical = std::equal( d.global_index.begin(), d.global_index.end(), s.global_index );
+            }
+        }
+        ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( identical, eckit::mpi::min() ); }
+        if ( identical ) {
+            plan.identity = true;
+            return plan;
+        }
+
+        // Global indices are distributed in contiguous blocks over all tasks, which serve as directory of the
+        // location of the checkpointed points
+        gidx_t max_gidx = 0;
+        for ( gidx_t g : d.global_index ) {
+            max_gidx = std::max( max_gidx, g );
+        }
+        for ( const auto& file : files_ ) {
+            const auto& s = file->space( space );
+            for ( size_t j = 0; j < s.size; ++j ) {
+                max_gidx = std::max( max_gidx, s.global_index[j] );
+            }
+        }
+        ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( max_gidx, eckit::mpi::max() ); }
+        auto directory = [&]( gidx_t g ) {
+            return static_cast<idx_t>( std::max<gidx_t>( 0, ( g * mpi_size_ ) / ( max_gidx + 1 ) ) );
+        };
+
+        std::vector<std::vector<gidx_t>> send( mpi_size_ );
+        std::vector<std::vector<gidx_t>> recv( mpi_size_ );
+
+        // 1) Register the owned points of the mapped files with the directory
+        for ( const auto& file : files_ ) {
+            const auto& s = file->space( space );
+            for ( size_t j = 0; j < s.size; ++j ) {
+                if ( s.owned[j] ) {
+                    auto& buffer = send[directory( s.global_index[j] )];
+                    buffer.emplace_back( s.global_index[j] );
+                    buffer.emplace_back( file->part() );
+                    buffer.emplace_back( static_cast<gidx_t>( j ) );
+                }
+            }
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( send, recv ); }
+        std::unordered_map<gidx_t, std::pair<gidx_t, gidx_t>> located;
+        for ( const auto& r : recv ) {
+            for ( size_t j = 0; j < r.size(); j += 3 ) {
+                located.emplace( r[j], std::make_pair( r[j + 1], r[j + 2] ) );
+            }
+        }
+
+        // 2) Look up where the owned points of the function space are located. Other points, e.g. halos or periodic
+        //    copies which have a global index of their own, are not owned by any checkpointed task either, and are
+        //    filled with a halo exchange instead
+        for ( auto& s : send ) {
+            s.clear();
+        }
+        int nb_not_owned = 0;
+        for ( size_t j = 0; j < d.global_index.size(); ++j ) {
+            if ( d.owned[j] ) {
+                send[directory( d.global_index[j] )].emplace_back( d.global_index[j] );
+            }
+            else {
+                ++nb_not_owned;
+            }
+        }
+        ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( nb_not_owned, eckit::mpi::sum() ); }
+        plan.halo_exchange = nb_not_owned > 0;
+        ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( send, recv ); }
+        std::vector<std::vector<gidx_t>> reply( mpi_size_ );
+        for ( idx_t jtask = 0; jtask < mpi_size_; ++jtask ) {
+            reply[jtask].reserve( 2 * recv[jtask].size() );
+            for ( gidx_t g : recv[jtask] ) {
+                auto it = located.find( g );
+                reply[jtask].emplace_back( it != located.end() ? it->second.first : -1 );
+                reply[jtask].emplace_back( it != located.end() ? it->second.second : -1 );
+            }
+        }
+        located.clear();
+        ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( reply, recv ); }
+
+        // 3) Request the values from the tasks that mapped the files; replies arrive in the order of the requests
+        for ( auto& s : send ) {
+            s.clear();
+        }
+        plan.recv.resize( mpi_size_ );
+        std::vector<size_t> next( mpi_size_, 0 );
+        int missing = 0;
+        for ( size_t j = 0; j < d.global_index.size(); ++j ) {
+            if ( not d.owned[j] ) {
+                continue;
+            }
+            const idx_t jtask  = directory( d.global_index[j] );
+            const gidx_t part  = recv[jtask][next[jtask]++];
+            const gidx_t point = recv[jtask][next[jtask]++];
+            if ( part < 0 ) {
+                ++missing;
+                continue;
+            }
+            const idx_t holder = static_cast<idx_t>( part % mpi_size_ );
+            send[holder].emplace_back( part );
+            send[holder].emplace_back( point );
+            plan.recv[holder].emplace_back( static_cast<idx_t>( j ) );
+        }
+        ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( missing, eckit::mpi::sum() ); }
+        if ( missing ) {
+            throw_Exception( std::to_string( missing ) + " points are not owned by any task in the checkpoint",
+                             Here() );
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( send, recv ); }
+        plan.send.resize( mpi_size_ );
+        for ( idx_t jtask = 0; jtask < mpi_size_; ++jtask ) {
+            plan.send[jtask].reserve( recv[jtask].size() / 2 );
+            for ( size_t j = 0; j < recv[jtask].size(); j += 2 ) {
+                plan.send[jtask].emplace_back( static_cast<idx_t>( recv[jtask][j] / mpi_size_ ),
+                                               static_cast<idx_t>( recv[jtask][j + 1] ) );
+            }
+        }
+        return plan;
+    }
+
+    void exchange( const Redistribution& plan, const std::string& name, char* target, size_t stride ) const {
+        std::vector<const char*> source( files_.size() );
+        for ( size_t jfile = 0; jfile < files_.size(); ++jfile ) {
+            source[jfile] = files_[jfile]->values( name );
+        }
+
+        std::vector<std::vector<char>> send( mpi_size_ );
+        std::vector<std::vector<char>> recv( mpi_size_ );
+        atlas_omp_parallel_for( idx_t jtask = 0; jtask < mpi_size_; ++jtask ) {
+            const auto& points = plan.send[jtask];
+            send[jtask].resize( points.size() * stride );
+            for ( size_t j = 0; j < points.size(); ++j ) {
+                std::memcpy( send[jtask].data() + j * stride, source[points[j].first] + points[j].second * stride,
+                             stride );
+            }
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( send, recv ); }
+        for ( idx_t jtask = 0; jtask < mpi_size_; ++jtask ) {
+            ATLAS_ASSERT( recv[jtask].size() == plan.recv[jtask].size() * stride );
+        }
+        atlas_omp_parallel_for( idx_t jtask = 0; jtask < mpi_size_; ++jtask ) {
+            const auto& points = plan.recv[jtask];
+            for ( size_t j = 0; j < points.size(); ++j ) {
+                std::memcpy( target + points[j] * stride, recv[jtask].data() + j * stride, stride );
+            }
+        }
+    }
+
+    idx_t mpi_rank_;
+    idx_t mpi_size_;
+    idx_t nb_parts_;
+    std::vector<std::shared_ptr<FieldsFile>> files_;
+    std::shared_ptr<FieldsFile> toc_;
+    std::map<std::pair<long, const void*>, Redistribution> plans_;
+};
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+Checkpoint::Checkpoint( const eckit::PathName& path ) : path_( path ) {}
+
+void Checkpoint::write( const Field& field ) const {
+    write_fields( path_, {field}, util::Metadata() );
+}
+
+void Checkpoint::write( const FieldSet& fieldset ) const {
+    std::vector<Field> fields;
+    for ( idx_t j = 0; j < fieldset.size(); ++j ) {
+        fields.emplace_back( fieldset[j] );
+    }
+    write_fields( path_, fields, util::Metadata() );
+}
+
+void Checkpoint::write( const field::State& state ) const {
+    std::vector<Field> fields;
+    for ( idx_t j = 0; j < state.size(); ++j ) {
+        fields.emplace_back( state[j] );
+    }
+    write_fields( path_, fields, state.metadata() );
+}
+
+void Checkpoint::write( const Mesh& mesh ) const {
+    ATLAS_TRACE( "Checkpoint::write mesh" );
+    const auto& comm = mpi::comm();
+    if ( comm.rank() == 0 ) {
+        path_.mkdir();
+    }
+    ATLAS_TRACE_MPI( BARRIER ) { comm.barrier(); }
+    detail::MeshIO::write( mesh_path( path_, static_cast<idx_t>( comm.rank() ) ), mesh );
+    ATLAS_TRACE_MPI( BARRIER ) { comm.barrier(); }
+}
+
+void Checkpoint::read( Field& field ) const {
+    CheckpointReader reader( path_ );
+    reader.read( field );
+}
+
+void Checkpoint::read( FieldSet& fieldset ) const {
+    CheckpointReader reader( path_ );
+    for ( idx_t j = 0; j < fieldset.size(); ++j ) {
+        reader.read( fieldset[j] );
+    }
+}
+
+void Checkpoint::read( field::State& state ) const {
+    CheckpointReader reader( path_ );
+    for ( idx_t j = 0; j < state.size(); ++j ) {
+        reader.read( state[j] );
+    }
+    reader.read( state.metadata() );
+}
+
+Mesh Checkpoint::read_mesh() const {
+    return detail::MeshIO::read( mesh_path( path_, static_cast<idx_t>( mpi::rank() ) ) );
+}
+
+std::vector<std::string> Checkpoint::field_names() const {
+    return FieldsFile( part_path( path_, 0 ) ).field_names();
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace output
+}  // namespace atlas
@@ -0,0 +1,73 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+
+namespace atlas {
+class Field;
+class FieldSet;
+class Mesh;
+namespace field {
+class State;
+}
+}  // namespace atlas
+
+namespace atlas {
+namespace output {
+
+/// @brief Native binary checkpoint of distributed fields
+///
+/// A checkpoint is a directory containing one file per MPI task, which every task writes and reads
+/// independently; nothing is gathered. Each file contains the local field values including halos, the field
+/// metadata, and the global index and ownership of the points of each function space.
+///
+/// Fields are read into existing fields, matched by name, and the files are memory-mapped. When the checkpoint was
+/// written by the same number of tasks with the same distribution, values are copied directly from the mapping.
+/// Otherwise, e.g. to restart on a different number of tasks, values of owned points are redistributed by global
+/// index, and halos are filled with a halo exchange of the function space. Fields on function spaces without global
+/// index (e.g. Spectral) can only be read with the original distribution.
+///
+/// A fully built mesh, including halos and parallel fields, can be stored alongside the fields in one file per task.
+/// It is read back with the same number of tasks by memory-mapping the files, without copying nor rebuilding, so that
+/// function spaces can be created on it directly. Such a mesh cannot be extended, e.g. with a larger halo.
+///
+/// All methods are collective over mpi::comm().
+class Checkpoint {
+public:
+    Checkpoint( const eckit::PathName& path );
+
+    void write( const Field& ) const;
+    void write( const FieldSet& ) const;
+    void write( const field::State& ) const;
+    void write( const Mesh& ) const;
+
+    void read( Field& ) const;
+    void read( FieldSet& ) const;
+    void read( field::State& ) const;
+
+    /// @brief Mesh written with write( const Mesh& ), by the same number of tasks
+    Mesh read_mesh() const;
+
+    /// @brief Names of the fields in the checkpoint
+    std::vector<std::string> field_names() const;
+
+    const eckit::PathName& path() const { return path_; }
+
+private:
+    eckit::PathName path_;
+};
+
+}  // namespace output
+}  // namespace atlas
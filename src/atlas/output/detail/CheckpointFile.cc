@@ -0,0 +1,117 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/output/detail/CheckpointFile.h"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+#include "eckit/log/Bytes.h"
+#include "eckit/log/JSON.h"
+
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+namespace {
+
+struct CheckpointFileHeader {
+    char magic[8];
+    std::uint64_t version;
+    std::uint64_t nb_parts;
+    std::uint64_t part;
+    std::uint64_t sizeof_gidx;
+    std::uint64_t sizeof_idx;
+    std::uint64_t toc_size;
+};
+
+constexpr char checkpoint_file_magic[8]         = {'A', 'T', 'L', 'A', 'S', 'C', 'K', 'P'};
+constexpr std::uint64_t checkpoint_file_version = 2;  // 2: sizeof_idx in header
+
+}  // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+CheckpointFile::CheckpointFile( const eckit::PathName& path ) : file_( std::make_shared<util::MappedFile>( path ) ) {
+    if ( file_->size() < sizeof( CheckpointFileHeader ) ) {
+        throw_Exception( "Checkpoint file " + path.asString() + " is corrupt", Here() );
+    }
+    const auto& header = *reinterpret_cast<const CheckpointFileHeader*>( file_->data() );
+    if ( std::memcmp( header.magic, checkpoint_file_magic, sizeof( checkpoint_file_magic ) ) != 0 ||
+         header.version != checkpoint_file_version || header.sizeof_gidx != sizeof( gidx_t ) ||
+         header.sizeof_idx != sizeof( idx_t ) ) {
+        throw_Exception( "Checkpoint file " + path.asString() + " is not compatible", Here() );
+    }
+    nb_parts_ = static_cast<idx_t>( header.nb_parts );
+    part_     = static_cast<idx_t>( header.part );
+
+    const size_t toc_offset = util::align( sizeof( CheckpointFileHeader ) );
+    data_offset_            = toc_offset + util::align( header.toc_size );
+    if ( data_offset_ > file_->size() ) {
+        throw_Exception( "Checkpoint file " + path.asString() + " is corrupt", Here() );
+    }
+    std::istringstream toc_stream( std::string( file_->data() + toc_offset, header.toc_size ) );
+    toc_ = util::Config( toc_stream );
+}
+
+const char* CheckpointFile::section_address( long offset, size_t bytes ) const {
+    const size_t begin = data_offset_ + static_cast<size_t>( offset );
+    if ( offset < 0 || begin + bytes > file_->size() ) {
+        throw_Exception( "Checkpoint file " + path().asString() + " is corrupt", Here() );
+    }
+    return file_->data() + begin;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+long CheckpointFileWriter::add( const void* data, size_t bytes ) {
+    sections_.emplace_back( data, bytes );
+    long offset = static_cast<long>( size_ );
+    size_ += util::align( bytes );
+    return offset;
+}
+
+void CheckpointFileWriter::write( const eckit::PathName& path, const util::Config& toc, idx_t nb_parts,
+                                  idx_t part ) const {
+    std::string toc_json;
+    {
+        std::stringstream s;
+        eckit::JSON json( s );
+        json.precision( 17 );
+        json << toc;
+        toc_json = s.str();
+    }
+
+    CheckpointFileHeader header;
+    std::memcpy( header.magic, checkpoint_file_magic, sizeof( checkpoint_file_magic ) );
+    header.version     = checkpoint_file_version;
+    header.nb_parts    = static_cast<std::uint64_t>( nb_parts );
+    header.part        = static_cast<std::uint64_t>( part );
+    header.sizeof_gidx = sizeof( gidx_t );
+    header.sizeof_idx  = sizeof( idx_t );
+    header.toc_size    = toc_json.size();
+
+    util::MappedFileWriter file( path );
+    file.write( &header, sizeof( header ) );
+    file.write( toc_json.data(), toc_json.size() );
+    for ( const auto& section : sections_ ) {
+        file.write( section.first, section.second );
+    }
+    file.close();
+    Log::debug() << "Written checkpoint file " << path << " (" << eckit::Bytes( path.size() ) << ")" << std::endl;
+}
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
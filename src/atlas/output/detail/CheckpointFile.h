@@ -0,0 +1,88 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas/library/config.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/MappedFile.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+/// @brief Memory-mapped file of a checkpoint, written by one MPI task
+///
+/// On-disk layout: header, table of contents in JSON, followed by the data sections. Offsets in the table of
+/// contents are relative to the first data section. All sections start at multiples of 8 bytes so that the
+/// memory-mapped arrays are properly aligned.
+class CheckpointFile {
+public:
+    CheckpointFile( const eckit::PathName& );
+
+    const eckit::PathName& path() const { return file_->path(); }
+    idx_t nb_parts() const { return nb_parts_; }
+    idx_t part() const { return part_; }
+    const util::Config& toc() const { return toc_; }
+
+    /// @brief Array of count values of type T, starting at offset of the data sections
+    template <typename T>
+    const T* section( long offset, size_t count ) const {
+        return reinterpret_cast<const T*>( section_address( offset, count * sizeof( T ) ) );
+    }
+
+    /// @brief Writable array of count values of type T; writes do not change the file
+    template <typename T>
+    T* section( long offset, size_t count ) {
+        return reinterpret_cast<T*>( const_cast<char*>( section_address( offset, count * sizeof( T ) ) ) );
+    }
+
+    /// @brief The mapping, to be kept alive by whoever keeps pointers into it
+    const std::shared_ptr<util::MappedFile>& mapping() const { return file_; }
+
+private:
+    const char* section_address( long offset, size_t bytes ) const;
+
+    std::shared_ptr<util::MappedFile> file_;
+    idx_t nb_parts_;
+    idx_t part_;
+    size_t data_offset_;
+    util::Config toc_;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// @brief Writer of a CheckpointFile
+///
+/// Sections are only referenced when added, and must remain valid until write() returns.
+class CheckpointFileWriter {
+public:
+    /// @brief Add a data section
+    /// @return offset of the section, to be stored in the table of contents
+    long add( const void* data, size_t bytes );
+
+    /// @brief Write header, table of contents and all sections; the file appears atomically
+    void write( const eckit::PathName&, const util::Config& toc, idx_t nb_parts, idx_t part ) const;
+
+private:
+    std::vector<std::pair<const void*, size_t>> sections_;
+    size_t size_{0};
+};
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
@@ -0,0 +1,367 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/output/detail/MeshIO.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/library/config.h"
+#include "atlas/mesh/Connectivity.h"
+#include "atlas/mesh/ElementType.h"
+#include "atlas/mesh/Elements.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/projection/Projection.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Metadata.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+namespace {
+
+// Array storage of a memory-mapped section, which keeps the mapping alive as long as the array exists
+template <typename Value>
+class MappedDataStore : public array::ArrayDataStore {
+public:
+    MappedDataStore( Value* data, const std::shared_ptr<util::MappedFile>& file ) : data_( data ), file_( file ) {}
+
+    virtual void updateHost() const override {}
+
+    virtual void updateDevice() const override {}
+
+    virtual bool valid() const override { return true; }
+
+    virtual void syncHostDevice() const override {}
+
+    virtual bool hostNeedsUpdate() const override { return false; }
+
+    virtual bool deviceNeedsUpdate() const override { return false; }
+
+    virtual void reactivateDeviceWriteViews() const override {}
+
+    virtual void reactivateHostWriteViews() const override {}
+
+    virtual void* voidDataStore() override { return static_cast<void*>( data_ ); }
+
+    virtual void* voidHostData() override { return static_cast<void*>( data_ ); }
+
+    virtual void* voidDeviceData() override { return static_cast<void*>( data_ ); }
+
+private:
+    Value* data_;
+    std::shared_ptr<util::MappedFile> file_;
+};
+
+template <typename Value>
+array::Array* mapped_array( CheckpointFile& file, long offset, const array::ArraySpec& spec ) {
+#if ATLAS_HAVE_GRIDTOOLS_STORAGE
+    throw_Exception( "Memory-mapped meshes require native array storage", Here() );
+#else
+    Value* data = file.section<Value>( offset, spec.size() );
+    return new array::ArrayT<Value>( new MappedDataStore<Value>( data, file.mapping() ), spec );
+#endif
+}
+
+util::Config write_section( CheckpointFileWriter& writer, const array::SVector<idx_t>& v ) {
+    util::Config section;
+    section.set( "offset", writer.add( v.data(), v.size() * sizeof( idx_t ) ) );
+    section.set( "size", v.size() );
+    return section;
+}
+
+void read_section( CheckpointFile& file, const util::Config& record, const std::string& name,
+                   array::SVector<idx_t>& v ) {
+    util::Config section = record.getSubConfiguration( name );
+    const idx_t size     = section.getInt( "size" );
+    // Release owned memory first, as the move assignment would leak it
+    v.clear();
+    v = array::SVector<idx_t>( file.section<idx_t>( section.getLong( "offset" ), size_t( size ) ), size );
+}
+
+template <typename Container>
+std::vector<util::Config> write_fields( CheckpointFileWriter& writer, const Container& container ) {
+    std::vector<util::Config> records;
+    for ( idx_t j = 0; j < container.nb_fields(); ++j ) {
+        const Field& field = container.field( j );
+        ATLAS_ASSERT( field.contiguous(), "Only contiguous mesh fields can be checkpointed" );
+        switch ( field.datatype().kind() ) {
+            case array::DataType::KIND_INT32:
+            case array::DataType::KIND_INT64:
+            case array::DataType::KIND_REAL32:
+            case array::DataType::KIND_REAL64:
+                break;
+            default:
+                throw_Exception( "Cannot checkpoint mesh field \"" + field.name() + "\" with datatype " +
+                                     field.datatype().str(),
+                                 Here() );
+        }
+        util::Config record;
+        record.set( "name", field.name() );
+        record.set( "datatype", field.datatype().str() );
+        record.set( "shape", std::vector<long>( field.shape().begin(), field.shape().end() ) );
+        record.set( "offset", writer.add( field.array().storage(), field.size() * field.datatype().size() ) );
+        record.set( "metadata", eckit::LocalConfiguration( field.metadata() ) );
+        records.emplace_back( record );
+    }
+    return records;
+}
+
+Field read_field( CheckpointFile& file, const util::Config& record ) {
+    std::vector<long> shape;
+    record.get( "shape", shape );
+    const array::ArraySpec spec( array::ArrayShape( std::vector<idx_t>( shape.begin(), shape.end() ) ) );
+    const long offset = record.getLong( "offset" );
+
+    array::Array* array = nullptr;
+    switch ( array::DataType( record.getString( "datatype" ) ).kind() ) {
+        case array::DataType::KIND_INT32:
+            array = mapped_array<int>( file, offset, spec );
+            break;
+        case array::DataType::KIND_INT64:
+            array = mapped_array<long>( file, offset, spec );
+            break;
+        case array::DataType::KIND_REAL32:
+            array = mapped_array<float>( file, offset, spec );
+            break;
+        case array::DataType::KIND_REAL64:
+            array = mapped_array<double>( file, offset, spec );
+            break;
+        default:
+            ATLAS_NOTIMPLEMENTED;
+    }
+    Field field( record.getString( "name" ), array );
+    field.metadata() = util::Metadata( record.getSubConfiguration( "metadata" ) );
+    return field;
+}
+
+}  // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+util::Config MeshIO::write_connectivity( CheckpointFileWriter& writer, const mesh::IrregularConnectivityImpl& c ) {
+    util::Config record;
+    record.set( "name", c.name() );
+    record.set( "rows", c.rows_ );
+    record.set( "missing_value", c.missing_value_ );
+    record.set( "maxcols", c.maxcols_ );
+    record.set( "mincols", c.mincols_ );
+    record.set( "values", write_section( writer, c.values_ ) );
+    record.set( "displs", write_section( writer, c.displs_ ) );
+    record.set( "counts", write_section( writer, c.counts_ ) );
+    return record;
+}
+
+util::Config MeshIO::write_connectivity( CheckpointFileWriter& writer, const mesh::MultiBlockConnectivityImpl& c ) {
+    util::Config record = write_connectivity( writer, static_cast<const mesh::IrregularConnectivityImpl&>( c ) );
+    record.set( "blocks", c.blocks_ );
+    record.set( "block_displs", write_section( writer, c.block_displs_ ) );
+    record.set( "block_cols", write_section( writer, c.block_cols_ ) );
+    return record;
+}
+
+util::Config MeshIO::write_nodes( CheckpointFileWriter& writer, const mesh::Nodes& nodes ) {
+    std::vector<util::Config> connectivities;
+    for ( const auto& connectivity : nodes.connectivities_ ) {
+        connectivities.emplace_back( write_connectivity( writer, *connectivity.second ) );
+    }
+    util::Config record;
+    record.set( "size", nodes.size() );
+    record.set( "metadata", eckit::LocalConfiguration( nodes.metadata() ) );
+    record.set( "fields", write_fields( writer, nodes ) );
+    record.set( "connectivities", connectivities );
+    return record;
+}
+
+util::Config MeshIO::write_elements( CheckpointFileWriter& writer, const mesh::HybridElements& elements ) {
+    std::vector<std::string> element_types;
+    std::vector<long> elements_size;
+    for ( idx_t t = 0; t < elements.nb_types(); ++t ) {
+        element_types.emplace_back( elements.element_type( t ).name() );
+        elements_size.emplace_back( elements.elements_size_[t] );
+    }
+    std::vector<util::Config> connectivities;
+    for ( const auto& connectivity : elements.connectivities_ ) {
+        connectivities.emplace_back( write_connectivity( writer, *connectivity.second ) );
+    }
+    util::Config record;
+    record.set( "size", elements.size() );
+    record.set( "element_types", element_types );
+    record.set( "elements_size", elements_size );
+    record.set( "metadata", eckit::LocalConfiguration( elements.metadata() ) );
+    record.set( "fields", write_fields( writer, elements ) );
+    record.set( "connectivities", connectivities );
+    return record;
+}
+
+void MeshIO::write( const eckit::PathName& path, const Mesh& mesh ) {
+    ATLAS_TRACE( "MeshIO::write" );
+    CheckpointFileWriter writer;
+
+    util::Config toc;
+    toc.set( "metadata", eckit::LocalConfiguration( mesh.metadata() ) );
+    if ( mesh.projection() ) {
+        toc.set( "projection", mesh.projection().spec() );
+    }
+    // Unstructured grids are not stored, as their specification contains all points
+    if ( grid::StructuredGrid( mesh.grid() ) ) {
+        toc.set( "grid", mesh.grid().spec() );
+    }
+    toc.set( "nodes", write_nodes( writer, mesh.nodes() ) );
+    toc.set( "cells", write_elements( writer, mesh.cells() ) );
+    toc.set( "facets", write_elements( writer, mesh.facets() ) );
+    toc.set( "ridges", write_elements( writer, mesh.ridges() ) );
+    toc.set( "peaks", write_elements( writer, mesh.peaks() ) );
+
+    writer.write( path, toc, mesh.nb_partitions(), mesh.partition() );
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void MeshIO::read_connectivity( CheckpointFile& file, const util::Config& record,
+                                mesh::IrregularConnectivityImpl& c ) {
+    read_section( file, record, "values", c.values_ );
+    read_section( file, record, "displs", c.displs_ );
+    read_section( file, record, "counts", c.counts_ );
+    c.missing_value_ = record.getInt( "missing_value" );
+    c.rows_          = record.getInt( "rows" );
+    c.maxcols_       = record.getInt( "maxcols" );
+    c.mincols_       = record.getInt( "mincols" );
+    // The memory-mapped tables cannot be resized, and keep the mapping alive
+    c.owns_             = false;
+    c.external_storage_ = file.mapping();
+}
+
+void MeshIO::read_connectivity( CheckpointFile& file, const util::Config& record,
+                                mesh::MultiBlockConnectivityImpl& c ) {
+    read_connectivity( file, record, static_cast<mesh::IrregularConnectivityImpl&>( c ) );
+    c.blocks_ = record.getInt( "blocks" );
+    read_section( file, record, "block_displs", c.block_displs_ );
+    read_section( file, record, "block_cols", c.block_cols_ );
+    c.block_.clear();
+    c.rebuild_block_connectivity();
+}
+
+void MeshIO::read_nodes( CheckpointFile& file, const util::Config& record, mesh::Nodes& nodes ) {
+    nodes.size_     = record.getInt( "size" );
+    nodes.metadata_ = util::Metadata( record.getSubConfiguration( "metadata" ) );
+
+    std::vector<util::Config> fields;
+    record.get( "fields", fields );
+    nodes.fields_.clear();
+    for ( const auto& field : fields ) {
+        Field f = read_field( file, field );
+        nodes.fields_[f.name()] = f;
+    }
+    nodes.global_index_ = nodes.field( "glb_idx" );
+    nodes.remote_index_ = nodes.field( "remote_idx" );
+    nodes.partition_    = nodes.field( "partition" );
+    nodes.xy_           = nodes.field( "xy" );
+    nodes.lonlat_       = nodes.field( "lonlat" );
+    nodes.ghost_        = nodes.field( "ghost" );
+    nodes.flags_        = nodes.field( "flags" );
+    nodes.halo_         = nodes.field( "halo" );
+
+    std::vector<util::Config> connectivities;
+    record.get( "connectivities", connectivities );
+    for ( const auto& connectivity : connectivities ) {
+        const std::string name = connectivity.getString( "name" );
+        if ( not nodes.has_connectivity( name ) ) {
+            nodes.add( new mesh::Nodes::Connectivity( name ) );
+        }
+        read_connectivity( file, connectivity, nodes.connectivity( name ) );
+    }
+}
+
+void MeshIO::read_elements( CheckpointFile& file, const util::Config& record, mesh::HybridElements& elements ) {
+    std::vector<std::string> element_types;
+    std::vector<long> elements_size;
+    record.get( "element_types", element_types );
+    record.get( "elements_size", elements_size );
+    ATLAS_ASSERT( element_types.size() == elements_size.size() );
+
+    elements.size_     = record.getInt( "size" );
+    elements.metadata_ = util::Metadata( record.getSubConfiguration( "metadata" ) );
+    elements.element_types_.clear();
+    elements.elements_size_.clear();
+    elements.elements_begin_.assign( 1, 0 );
+    elements.elements_.clear();
+    for ( size_t t = 0; t < element_types.size(); ++t ) {
+        elements.element_types_.emplace_back( mesh::ElementType::create( element_types[t] ) );
+        elements.elements_size_.emplace_back( static_cast<idx_t>( elements_size[t] ) );
+        elements.elements_begin_.emplace_back( elements.elements_begin_.back() + elements.elements_size_.back() );
+    }
+    ATLAS_ASSERT( elements.elements_begin_.back() == elements.size_ );
+    elements.type_idx_.resize( elements.size_ );
+    for ( idx_t t = 0; t < elements.nb_types(); ++t ) {
+        std::fill( elements.type_idx_.begin() + elements.elements_begin_[t],
+                   elements.type_idx_.begin() + elements.elements_begin_[t + 1], t );
+        elements.elements_.emplace_back( new mesh::Elements( elements, t ) );
+    }
+
+    std::vector<util::Config> fields;
+    record.get( "fields", fields );
+    elements.fields_.clear();
+    for ( const auto& field : fields ) {
+        Field f = read_field( file, field );
+        elements.fields_[f.name()] = f;
+    }
+
+    std::vector<util::Config> connectivities;
+    record.get( "connectivities", connectivities );
+    for ( const auto& connectivity : connectivities ) {
+        const std::string name = connectivity.getString( "name" );
+        if ( not elements.connectivities_.count( name ) ) {
+            elements.add( new mesh::HybridElements::Connectivity( name ) );
+        }
+        read_connectivity( file, connectivity, *elements.connectivities_[name] );
+    }
+}
+
+Mesh MeshIO::read( const eckit::PathName& path ) {
+    ATLAS_TRACE( "MeshIO::read" );
+    CheckpointFile file( path );
+    if ( file.nb_parts() != static_cast<idx_t>( mpi::size() ) || file.part() != static_cast<idx_t>( mpi::rank() ) ) {
+        throw_Exception( "Mesh file " + path.asString() + " was written for partition " +
+                             std::to_string( file.part() ) + " of " + std::to_string( file.nb_parts() ) +
+                             ", and can only be read by the same task with the same number of tasks",
+                         Here() );
+    }
+    const util::Config& toc = file.toc();
+
+    Mesh mesh;
+    if ( toc.has( "projection" ) ) {
+        mesh.setProjection( Projection( util::Config( toc.getSubConfiguration( "projection" ) ) ) );
+    }
+    if ( toc.has( "grid" ) ) {
+        mesh.setGrid( Grid( util::Config( toc.getSubConfiguration( "grid" ) ) ) );
+    }
+    mesh.metadata() = util::Metadata( toc.getSubConfiguration( "metadata" ) );
+    read_nodes( file, toc.getSubConfiguration( "nodes" ), mesh.nodes() );
+    read_elements( file, toc.getSubConfiguration( "cells" ), mesh.cells() );
+    read_elements( file, toc.getSubConfiguration( "facets" ), mesh.facets() );
+    read_elements( file, toc.getSubConfiguration( "ridges" ), mesh.ridges() );
+    read_elements( file, toc.getSubConfiguration( "peaks" ), mesh.peaks() );
+    return mesh;
+}
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
@@ -0,0 +1,62 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas/output/detail/CheckpointFile.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+class Mesh;
+namespace mesh {
+class Nodes;
+class HybridElements;
+class IrregularConnectivityImpl;
+class MultiBlockConnectivityImpl;
+}  // namespace mesh
+}  // namespace atlas
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+/// @brief Serialisation of the local partition of a fully built Mesh to a CheckpointFile
+///
+/// All fields, connectivity tables and metadata of nodes, cells, facets, ridges and peaks are written as is,
+/// including halos and parallel fields. A mesh that is read back refers directly to the memory-mapped file, without
+/// copying. Its fields and connectivities can be modified (the file itself is never changed), but connectivities
+/// cannot grow, so that e.g. no further halo can be built on a loaded mesh.
+class MeshIO {
+public:
+    /// @brief Write the partition of this MPI task
+    static void write( const eckit::PathName&, const Mesh& );
+
+    /// @brief Read the partition of this MPI task, written with the same number of tasks
+    static Mesh read( const eckit::PathName& );
+
+private:
+    static util::Config write_nodes( CheckpointFileWriter&, const mesh::Nodes& );
+    static util::Config write_elements( CheckpointFileWriter&, const mesh::HybridElements& );
+    static util::Config write_connectivity( CheckpointFileWriter&, const mesh::IrregularConnectivityImpl& );
+    static util::Config write_connectivity( CheckpointFileWriter&, const mesh::MultiBlockConnectivityImpl& );
+
+    static void read_nodes( CheckpointFile&, const util::Config&, mesh::Nodes& );
+    static void read_elements( CheckpointFile&, const util::Config&, mesh::HybridElements& );
+    static void read_connectivity( CheckpointFile&, const util::Config&, mesh::IrregularConnectivityImpl& );
+    static void read_connectivity( CheckpointFile&, const util::Config&, mesh::MultiBlockConnectivityImpl& );
+};
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
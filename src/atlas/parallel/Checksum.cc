@@ -8,7 +8,9 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <cstring>
+#include <utility>
 
 #include "atlas/parallel/Checksum.h"
 
@@ -25,22 +27,49 @@ Checksum::Checksum( const std::string& name ) : name_( name ) {
 
 void Checksum::setup( const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
                       const int parsize ) {
-    parsize_ = parsize;
-    gather_  = util::ObjectHandle<GatherScatter>( new GatherScatter() );
-    gather_->setup( part, remote_idx, base, glb_idx, parsize );
-    is_setup_ = true;
+    // Mask ghost points, as in GatherScatter::setup
+    const int mypart = static_cast<int>( mpi::rank() );
+    std::vector<int> mask( parsize );
+    for ( int n = 0; n < parsize; ++n ) {
+        mask[n] = ( part[n] != mypart || remote_idx[n] != base + n ) ? 1 : 0;
+    }
+    setup( part, remote_idx, base, glb_idx, mask.data(), parsize );
 }
 
 void Checksum::setup( const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
                       const int mask[], const int parsize ) {
+    ATLAS_TRACE( "Checksum::setup" );
     parsize_ = parsize;
-    gather_  = util::ObjectHandle<GatherScatter>( new GatherScatter() );
-    gather_->setup( part, remote_idx, base, glb_idx, mask, parsize );
+
+    // Points owned by this partition, without duplicates (e.g. periodic points). Unlike GatherScatter::setup,
+    // no communication is required, as every owned point is assumed to be unmasked on its own partition.
+    const int mypart = static_cast<int>( mpi::rank() );
+    std::vector<std::pair<gidx_t, int>> owned;
+    owned.reserve( parsize );
+    for ( int n = 0; n < parsize; ++n ) {
+        if ( !mask[n] && part[n] == mypart ) {
+            owned.emplace_back( glb_idx[n], static_cast<int>( remote_idx[n] - base ) );
+        }
+    }
+    std::sort( owned.begin(), owned.end() );
+    owned.erase( std::unique( owned.begin(), owned.end(),
+                              []( const std::pair<gidx_t, int>& a, const std::pair<gidx_t, int>& b ) {
+                                  return a.first == b.first;
+                              } ),
+                 owned.end() );
+
+    locmap_.resize( owned.size() );
+    glbidx_.resize( owned.size() );
+    for ( size_t j = 0; j < owned.size(); ++j ) {
+        glbidx_[j] = owned[j].first;
+        locmap_[j] = owned[j].second;
+    }
     is_setup_ = true;
 }
 
 void Checksum::setup( const util::ObjectHandle<GatherScatter>& gather ) {
-    gather_   = gather;
+    locmap_   = gather->locmap_;
+    glbidx_   = gather->locglb_;
     parsize_  = gather->parsize_;
     is_setup_ = true;
 }
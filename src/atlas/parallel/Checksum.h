@@ -16,7 +16,10 @@
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
+#include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/Checksum.h"
 #include "atlas/util/Object.h"
 #include "atlas/util/ObjectHandle.h"
@@ -24,6 +27,11 @@
 namespace atlas {
 namespace parallel {
 
+/// @brief Checksum of a distributed field
+///
+/// The checksum is computed from the points owned by each partition and does not depend on the distribution.
+/// Each owned point contributes a checksum of its values and its global index; these are summed locally
+/// and then across tasks with a single reduction, so that no per-point data is communicated.
 class Checksum : public util::Object {
 public:
     Checksum();
@@ -74,7 +82,8 @@ public:  // methods
 
 private:  // data
     std::string name_;
-    util::ObjectHandle<GatherScatter> gather_;
+    std::vector<int> locmap_;     // local indices of owned points
+    std::vector<gidx_t> glbidx_;  // global indices of owned points
     bool is_setup_;
     size_t parsize_;
 };
@@ -82,26 +91,23 @@ private:  // data
 template <typename DATA_TYPE>
 std::string Checksum::execute( const DATA_TYPE data[], const int var_strides[], const int var_extents[],
                                const int var_rank ) const {
-    idx_t root = 0;
-
     if ( !is_setup_ ) {
         throw_Exception( "Checksum was not setup", Here() );
     }
-    std::vector<util::checksum_t> local_checksums( parsize_ );
-    int var_size = var_extents[0] * var_strides[0];
-
-    for ( size_t pp = 0; pp < parsize_; ++pp ) {
-        local_checksums[pp] = util::checksum( data + pp * var_size, var_size );
+    ATLAS_TRACE( "Checksum::execute" );
+    const size_t var_size = var_extents[0] * var_strides[0];
+    const idx_t nb_owned  = static_cast<idx_t>( locmap_.size() );
+    std::vector<util::checksum_t> point_checksums( nb_owned );
+    atlas_omp_parallel_for( idx_t j = 0; j < nb_owned; ++j ) {
+        point_checksums[j] = util::checksum( data + locmap_[j] * var_size, var_size, glbidx_[j] );
     }
 
-    std::vector<util::checksum_t> global_checksums( mpi::rank() == root ? gather_->glb_dof() : 0 );
-    parallel::Field<util::checksum_t const> loc( local_checksums.data(), 1 );
-    parallel::Field<util::checksum_t> glb( global_checksums.data(), 1 );
-    gather_->gather( &loc, &glb, 1 );
-
-    util::checksum_t glb_checksum = util::checksum( global_checksums.data(), global_checksums.size() );
-
-    mpi::comm().broadcast( glb_checksum, root );
+    // Unsigned addition wraps around, so the result does not depend on the order of summation
+    util::checksum_t glb_checksum = 0;
+    for ( const auto& c : point_checksums ) {
+        glb_checksum += c;
+    }
+    ATLAS_TRACE_MPI( ALLREDUCE ) { mpi::comm().allReduceInPlace( glb_checksum, eckit::mpi::sum() ); }
 
     return eckit::Translator<util::checksum_t, std::string>()( glb_checksum );
 }
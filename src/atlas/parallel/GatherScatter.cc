@@ -14,6 +14,8 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "eckit/config/Resource.h"
+
 #include "atlas/array.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
@@ -65,14 +67,21 @@ struct Node {
     bool operator==( const Node& other ) const { return ( g == other.g ); }
 };
 
+size_t default_max_message_size() {
+    static size_t max_message_size =
+        size_t( eckit::Resource<long>( "$ATLAS_GATHER_MAX_MESSAGE_SIZE", 64 * 1024 * 1024 ) );
+    return max_message_size;
+}
+
 }  // namespace
 
-GatherScatter::GatherScatter() : name_(), is_setup_( false ) {
+GatherScatter::GatherScatter() : name_(), is_setup_( false ), max_message_size_( default_max_message_size() ) {
     myproc = mpi::rank();
     nproc  = mpi::size();
 }
 
-GatherScatter::GatherScatter( const std::string& name ) : name_( name ), is_setup_( false ) {
+GatherScatter::GatherScatter( const std::string& name ) :
+    name_( name ), is_setup_( false ), max_message_size_( default_max_message_size() ) {
     myproc = mpi::rank();
     nproc  = mpi::size();
 }
@@ -150,6 +159,8 @@ void GatherScatter::setup( const int part[], const idx_t remote_idx[], const int
     glbmap_.resize( glbcnt_ );
     locmap_.clear();
     locmap_.resize( loccnt_ );
+    locglb_.clear();
+    locglb_.resize( loccnt_ );
     std::vector<int> idx( nproc, 0 );
 
     int n{0};
@@ -159,6 +170,7 @@ void GatherScatter::setup( const int part[], const idx_t remote_idx[], const int
 
         if ( jproc == myproc ) {
             locmap_[idx[jproc]] = node.i;
+            locglb_[idx[jproc]] = node.g;
         }
 
         ++idx[jproc];
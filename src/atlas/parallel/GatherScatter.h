@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
@@ -18,6 +19,7 @@
 #include "atlas/array/ArrayView.h"
 #include "atlas/library/config.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Object.h"
 
@@ -137,10 +139,44 @@ public:  // methods
     void gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
                  const idx_t nb_fields, const idx_t root = 0 ) const;
 
+    /// @brief Gather fields to different roots at once
+    ///
+    /// Field jfield is gathered on task roots[jfield], so that e.g. output of many fields can be spread
+    /// round-robin over a set of I/O tasks. Fields are gathered in batches, whose global size is bounded by
+    /// max_message_size() (a batch holds at least one field). Within a batch, every task sends a single message
+    /// per root, containing all its fields for that root, with non-blocking point-to-point communication; roots
+    /// unpack their own contribution first, then wait for those of the other tasks one by one, in cyclic rank
+    /// order starting after their own rank.
+    /// @param [in]  lfields     local fields
+    /// @param [out] gfields     global fields, only accessed on their root
+    /// @param [in]  nb_fields   number of fields
+    /// @param [in]  roots       root task of every field
+    template <typename DATA_TYPE>
+    void gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                 const idx_t nb_fields, const idx_t roots[] ) const;
+
     template <typename DATA_TYPE, int LRANK, int GRANK>
     void gather( const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
                  const idx_t root = 0 ) const;
 
+    /// @brief Gather a field to the root in chunks of consecutive global indices, without global field
+    ///
+    /// Peak memory on the root is set by the chunk size rather than by the global size, so that e.g. each chunk
+    /// can be encoded or written, and dropped, before the next chunk arrives.
+    /// @param [in] lfield      local field
+    /// @param [in] callback    called on the root only, for every chunk in order, as
+    ///                         callback( gidx_t begin, gidx_t end, const DATA_TYPE values[] ), with values of
+    ///                         global points [begin,end) contiguous as in a global field of (end-begin) points
+    /// @param [in] chunk_size  maximum number of global points per chunk
+    /// @param [in] root        task receiving the chunks
+    template <typename DATA_TYPE, typename Callback>
+    void gather_chunked( const parallel::Field<DATA_TYPE const>& lfield, Callback callback, const idx_t chunk_size,
+                         const idx_t root = 0 ) const;
+
+    template <typename DATA_TYPE, int LRANK, typename Callback>
+    void gather_chunked( const array::ArrayView<DATA_TYPE, LRANK>& ldata, Callback callback, const idx_t chunk_size,
+                         const idx_t root = 0 ) const;
+
     template <typename DATA_TYPE>
     void scatter( parallel::Field<DATA_TYPE const> gfields[], parallel::Field<DATA_TYPE> lfields[],
                   const idx_t nb_fields, const idx_t root = 0 ) const;
@@ -160,19 +196,68 @@ public:  // methods
     void scatter( const array::ArrayView<DATA_TYPE, GRANK>& gdata, array::ArrayView<DATA_TYPE, LRANK>& ldata,
                   const idx_t root = 0 ) const;
 
+    /// @brief Maximum size in bytes of the fields gathered in one batch, counted with their global size
+    ///
+    /// Bounds the extra memory of a gather on its roots. Defaults to $ATLAS_GATHER_MAX_MESSAGE_SIZE, or 64 MiB.
+    size_t max_message_size() const { return max_message_size_; }
+    void max_message_size( size_t bytes ) { max_message_size_ = bytes; }
+
+    /// @brief Keep communication buffers for subsequent gathers, instead of releasing them after every call
+    ///
+    /// Concurrent gathers with the same GatherScatter are then not allowed.
+    bool keep_buffers() const { return keep_buffers_; }
+    void keep_buffers( bool keep ) { keep_buffers_ = keep; }
+
     gidx_t glb_dof() const { return glbcnt_; }
 
     idx_t loc_dof() const { return loccnt_; }
 
 private:  // methods
     template <typename DATA_TYPE>
-    void pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
+    void gather_batch( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                       const idx_t nb_fields, const idx_t roots[] ) const;
+
+    void release_buffers() const {
+        if ( not keep_buffers_ ) {
+            std::vector<char>().swap( send_buffer_ );
+            std::vector<char>().swap( recv_buffer_ );
+        }
+    }
+
+    template <typename DATA_TYPE>
+    void pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const int sendmap[], const idx_t sendcnt,
                            DATA_TYPE send_buffer[] ) const;
 
     template <typename DATA_TYPE>
-    void unpack_recv_buffer( const std::vector<int>& recvmap, const DATA_TYPE recv_buffer[],
+    void pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
+                           DATA_TYPE send_buffer[] ) const {
+        pack_send_buffer( field, sendmap.data(), static_cast<idx_t>( sendmap.size() ), send_buffer );
+    }
+
+    template <typename DATA_TYPE>
+    void unpack_recv_buffer( const int recvmap[], const idx_t recvcnt, const DATA_TYPE recv_buffer[],
                              const parallel::Field<DATA_TYPE>& field ) const;
 
+    template <typename DATA_TYPE>
+    void unpack_recv_buffer( const std::vector<int>& recvmap, const DATA_TYPE recv_buffer[],
+                             const parallel::Field<DATA_TYPE>& field ) const {
+        unpack_recv_buffer( recvmap.data(), static_cast<idx_t>( recvmap.size() ), recv_buffer, field );
+    }
+
+    template <typename DATA_TYPE>
+    static idx_t var_size( const parallel::Field<DATA_TYPE>& field ) {
+        return std::accumulate( field.var_shape.data(), field.var_shape.data() + field.var_rank, 1,
+                                std::multiplies<idx_t>() );
+    }
+
+    template <typename DATA_TYPE>
+    DATA_TYPE* buffer( std::vector<char>& buffer, size_t size ) const {
+        if ( buffer.size() < size * sizeof( DATA_TYPE ) ) {
+            buffer.resize( size * sizeof( DATA_TYPE ) );
+        }
+        return reinterpret_cast<DATA_TYPE*>( buffer.data() );
+    }
+
     template <typename DATA_TYPE, int RANK>
     void var_info( const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<idx_t>& varstrides,
                    std::vector<idx_t>& varshape ) const;
@@ -185,6 +270,7 @@ private:  // data
     std::vector<int> glbdispls_;
     std::vector<int> locmap_;
     std::vector<int> glbmap_;
+    std::vector<gidx_t> locglb_;  // global indices of the points in locmap_
 
     idx_t nproc;
     idx_t myproc;
@@ -194,6 +280,13 @@ private:  // data
     idx_t parsize_;
     friend class Checksum;
 
+    size_t max_message_size_;  // default from $ATLAS_GATHER_MAX_MESSAGE_SIZE, or 64 MiB
+    bool keep_buffers_{false};
+
+    // Communication buffers of gather, reused between batches and optionally between calls
+    mutable std::vector<char> send_buffer_;
+    mutable std::vector<char> recv_buffer_;
+
     int glb_cnt( idx_t root ) const { return myproc == root ? glbcnt_ : 0; }
 };
 
@@ -202,40 +295,251 @@ private:  // data
 template <typename DATA_TYPE>
 void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
                             idx_t nb_fields, const idx_t root ) const {
+    std::vector<idx_t> roots( nb_fields, root );
+    gather( lfields, gfields, nb_fields, roots.data() );
+}
+
+template <typename DATA_TYPE>
+void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                            const idx_t nb_fields, const idx_t roots[] ) const {
     if ( !is_setup_ ) {
         throw_Exception( "GatherScatter was not setup", Here() );
     }
 
+    // Batches depend only on global sizes, so that all tasks agree on them
+    idx_t begin = 0;
+    while ( begin < nb_fields ) {
+        idx_t end         = begin + 1;
+        size_t batch_size = size_t( glbcnt_ ) * size_t( var_size( lfields[begin] ) ) * sizeof( DATA_TYPE );
+        while ( end < nb_fields ) {
+            const size_t field_size = size_t( glbcnt_ ) * size_t( var_size( lfields[end] ) ) * sizeof( DATA_TYPE );
+            if ( batch_size + field_size > max_message_size_ ) {
+                break;
+            }
+            batch_size += field_size;
+            ++end;
+        }
+        gather_batch( lfields + begin, gfields + begin, end - begin, roots + begin );
+        begin = end;
+    }
+    release_buffers();
+}
+
+template <typename DATA_TYPE>
+void GatherScatter::gather_batch( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                                  const idx_t nb_fields, const idx_t roots[] ) const {
+    const auto& comm = mpi::comm();
+    const int tag    = 0;
+
+    // Message to every root, containing the fields of that root in order
+    std::vector<size_t> send_counts( nproc, 0 );
+    std::vector<size_t> send_displs( nproc, 0 );
+    std::vector<size_t> field_displs( nb_fields );
+    size_t recv_var_size = 0;  // sum of var sizes of fields gathered on this task
     for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
-        const idx_t lvar_size =
-            std::accumulate( lfields[jfield].var_shape.data(),
-                             lfields[jfield].var_shape.data() + lfields[jfield].var_rank, 1, std::multiplies<idx_t>() );
-        const idx_t gvar_size =
-            std::accumulate( gfields[jfield].var_shape.data(),
-                             gfields[jfield].var_shape.data() + gfields[jfield].var_rank, 1, std::multiplies<idx_t>() );
-        const int loc_size = loccnt_ * lvar_size;
-        const int glb_size = glb_cnt( root ) * gvar_size;
-        std::vector<DATA_TYPE> loc_buffer( loc_size );
-        std::vector<DATA_TYPE> glb_buffer( glb_size );
-        std::vector<int> glb_displs( nproc );
-        std::vector<int> glb_counts( nproc );
+        const idx_t root = roots[jfield];
+        ATLAS_ASSERT( 0 <= root && root < nproc );
+        send_counts[root] += size_t( loccnt_ ) * size_t( var_size( lfields[jfield] ) );
+        if ( myproc == root ) {
+            ATLAS_ASSERT( var_size( gfields[jfield] ) == var_size( lfields[jfield] ) );
+            recv_var_size += var_size( gfields[jfield] );
+        }
+    }
+    for ( idx_t jproc = 1; jproc < nproc; ++jproc ) {
+        send_displs[jproc] = send_displs[jproc - 1] + send_counts[jproc - 1];
+    }
+    {
+        std::vector<size_t> displs( send_displs );
+        for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+            field_displs[jfield] = displs[roots[jfield]];
+            displs[roots[jfield]] += size_t( loccnt_ ) * size_t( var_size( lfields[jfield] ) );
+        }
+    }
+
+    DATA_TYPE* send_buffer = buffer<DATA_TYPE>( send_buffer_, send_displs.back() + send_counts.back() );
+    DATA_TYPE* recv_buffer = buffer<DATA_TYPE>( recv_buffer_, size_t( glbcnt_ ) * recv_var_size );
+
+    /// Receive
+
+    std::vector<eckit::mpi::Request> recv_req( nproc );
+    if ( recv_var_size ) {
+        ATLAS_TRACE_MPI( IRECEIVE ) {
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                if ( jproc != myproc && glbcounts_[jproc] > 0 ) {
+                    recv_req[jproc] = comm.iReceive( recv_buffer + size_t( glbdispls_[jproc] ) * recv_var_size,
+                                                     size_t( glbcounts_[jproc] ) * recv_var_size, jproc, tag );
+                }
+            }
+        }
+    }
 
+    /// Pack
+
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        pack_send_buffer( lfields[jfield], locmap_, send_buffer + field_displs[jfield] );
+    }
+
+    /// Send
+
+    std::vector<eckit::mpi::Request> send_req( nproc );
+    ATLAS_TRACE_MPI( ISEND ) {
         for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
-            glb_counts[jproc] = glbcounts_[jproc] * gvar_size;
-            glb_displs[jproc] = glbdispls_[jproc] * gvar_size;
+            if ( jproc != myproc && send_counts[jproc] > 0 ) {
+                send_req[jproc] = comm.iSend( send_buffer + send_displs[jproc], send_counts[jproc], jproc, tag );
+            }
         }
+    }
 
-        /// Pack
+    /// Unpack, own contribution first, then task by task
+
+    if ( recv_var_size ) {
+        for ( idx_t j = 0; j < nproc; ++j ) {
+            const idx_t jproc = ( myproc + j ) % nproc;
+            if ( glbcounts_[jproc] == 0 ) {
+                continue;
+            }
+            const DATA_TYPE* recv_message = send_buffer + send_displs[myproc];
+            if ( jproc != myproc ) {
+                ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) { comm.wait( recv_req[jproc] ); }
+                recv_message = recv_buffer + size_t( glbdispls_[jproc] ) * recv_var_size;
+            }
+            for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+                if ( roots[jfield] == myproc ) {
+                    unpack_recv_buffer( glbmap_.data() + glbdispls_[jproc], glbcounts_[jproc], recv_message,
+                                        gfields[jfield] );
+                    recv_message += size_t( glbcounts_[jproc] ) * size_t( var_size( gfields[jfield] ) );
+                }
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
+        for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+            if ( jproc != myproc && send_counts[jproc] > 0 ) {
+                comm.wait( send_req[jproc] );
+            }
+        }
+    }
+}
+
+template <typename DATA_TYPE, typename Callback>
+void GatherScatter::gather_chunked( const parallel::Field<DATA_TYPE const>& lfield, Callback callback,
+                                    const idx_t chunk_size, const idx_t root ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "GatherScatter was not setup", Here() );
+    }
+    ATLAS_ASSERT( chunk_size > 0 );
+    ATLAS_ASSERT( 0 <= root && root < nproc );
+
+    const auto& comm  = mpi::comm();
+    const int tag     = 0;
+    const size_t nvar = size_t( var_size( lfield ) );
+
+    // Global positions of the points of every task increase (see setup), so that the points of a task
+    // within a chunk form a contiguous range
+    auto range = [&]( idx_t jproc, gidx_t gbegin, gidx_t gend ) {
+        const int* positions = glbmap_.data() + glbdispls_[jproc];
+        const int* first     = std::lower_bound( positions, positions + glbcounts_[jproc], gbegin );
+        const int* last      = std::lower_bound( first, positions + glbcounts_[jproc], gend );
+        return std::make_pair( idx_t( first - positions ), idx_t( last - positions ) );
+    };
+
+    // Chunk values, contiguous with the variable shape of the local field
+    std::vector<DATA_TYPE> chunk;
+    std::vector<int> chunk_map;
+    std::vector<idx_t> chunk_strides( lfield.var_rank );
+    if ( myproc == root ) {
+        chunk.resize( size_t( std::min<gidx_t>( chunk_size, glbcnt_ ) ) * nvar );
+        idx_t stride = 1;
+        for ( idx_t j = lfield.var_rank - 1; j >= 0; --j ) {
+            chunk_strides[j] = stride;
+            stride *= lfield.var_shape[j];
+        }
+    }
+    parallel::Field<DATA_TYPE> chunk_field( chunk.data(), chunk_strides.data(), lfield.var_shape.data(),
+                                            lfield.var_rank );
+
+    std::vector<idx_t> recv_begin( nproc );
+    std::vector<idx_t> recv_counts( nproc );
+    std::vector<size_t> recv_displs( nproc );
+    std::vector<eckit::mpi::Request> recv_req( nproc );
+
+    for ( gidx_t gbegin = 0; gbegin < glbcnt_; gbegin += chunk_size ) {
+        const gidx_t gend = std::min<gidx_t>( gbegin + chunk_size, glbcnt_ );
+
+        /// Receive
+
+        DATA_TYPE* recv_buffer = nullptr;
+        if ( myproc == root ) {
+            size_t recv_size = 0;
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                auto r             = range( jproc, gbegin, gend );
+                recv_begin[jproc]  = r.first;
+                recv_counts[jproc] = r.second - r.first;
+                recv_displs[jproc] = recv_size;
+                recv_size += size_t( recv_counts[jproc] ) * nvar;
+            }
+            recv_buffer = buffer<DATA_TYPE>( recv_buffer_, recv_size );
+            ATLAS_TRACE_MPI( IRECEIVE ) {
+                for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                    if ( jproc != root && recv_counts[jproc] > 0 ) {
+                        recv_req[jproc] = comm.iReceive( recv_buffer + recv_displs[jproc],
+                                                         size_t( recv_counts[jproc] ) * nvar, jproc, tag );
+                    }
+                }
+            }
+        }
 
-        pack_send_buffer( lfields[jfield], locmap_, loc_buffer.data() );
+        /// Pack and send
 
-        /// Gather
+        auto r                 = range( myproc, gbegin, gend );
+        const idx_t send_count = r.second - r.first;
+        DATA_TYPE* send_buffer = buffer<DATA_TYPE>( send_buffer_, size_t( send_count ) * nvar );
+        pack_send_buffer( lfield, locmap_.data() + r.first, send_count, send_buffer );
 
-        ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gatherv( loc_buffer, glb_buffer, glb_counts, glb_displs, root ); }
+        eckit::mpi::Request send_req;
+        if ( myproc != root && send_count > 0 ) {
+            ATLAS_TRACE_MPI( ISEND ) { send_req = comm.iSend( send_buffer, size_t( send_count ) * nvar, root, tag ); }
+        }
 
-        /// Unpack
-        if ( myproc == root )
-            unpack_recv_buffer( glbmap_, glb_buffer.data(), gfields[jfield] );
+        /// Unpack and deliver the chunk
+
+        if ( myproc == root ) {
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                if ( recv_counts[jproc] == 0 ) {
+                    continue;
+                }
+                const DATA_TYPE* recv_message = send_buffer;
+                if ( jproc != root ) {
+                    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) { comm.wait( recv_req[jproc] ); }
+                    recv_message = recv_buffer + recv_displs[jproc];
+                }
+                const int* positions = glbmap_.data() + glbdispls_[jproc] + recv_begin[jproc];
+                chunk_map.resize( recv_counts[jproc] );
+                for ( idx_t k = 0; k < recv_counts[jproc]; ++k ) {
+                    chunk_map[k] = static_cast<int>( positions[k] - gbegin );
+                }
+                unpack_recv_buffer( chunk_map.data(), recv_counts[jproc], recv_message, chunk_field );
+            }
+            const DATA_TYPE* values = chunk.data();
+            callback( gbegin, gend, values );
+        }
+
+        if ( myproc != root && send_count > 0 ) {
+            ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) { comm.wait( send_req ); }
+        }
+    }
+    release_buffers();
+}
+
+template <typename DATA_TYPE, int LRANK, typename Callback>
+void GatherScatter::gather_chunked( const array::ArrayView<DATA_TYPE, LRANK>& ldata, Callback callback,
+                                    const idx_t chunk_size, const idx_t root ) const {
+    if ( ldata.shape( 0 ) == parsize_ ) {
+        gather_chunked( parallel::Field<DATA_TYPE const>( ldata ), callback, chunk_size, root );
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;  // Need to implement with parallel ranks > 1
     }
 }
 
@@ -300,95 +604,112 @@ void GatherScatter::scatter( const DATA_TYPE gdata[], const idx_t gvar_strides[]
 }
 
 template <typename DATA_TYPE>
-void GatherScatter::pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
-                                      DATA_TYPE send_buffer[] ) const {
-    const idx_t sendcnt = static_cast<idx_t>( sendmap.size() );
-
-    idx_t ibuf              = 0;
+void GatherScatter::pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const int sendmap[],
+                                      const idx_t sendcnt, DATA_TYPE send_buffer[] ) const {
     const idx_t send_stride = field.var_strides[0] * field.var_shape[0];
 
     switch ( field.var_rank ) {
-        case 1:
-            for ( idx_t p = 0; p < sendcnt; ++p ) {
+        case 1: {
+            const idx_t ni = field.var_shape[0];
+            atlas_omp_parallel_for( idx_t p = 0; p < sendcnt; ++p ) {
                 const idx_t pp = send_stride * sendmap[p];
-                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
-                    DATA_TYPE tmp       = field.data[pp + i * field.var_strides[0]];
-                    send_buffer[ibuf++] = tmp;
+                idx_t ibuf     = p * ni;
+                for ( idx_t i = 0; i < ni; ++i ) {
+                    send_buffer[ibuf++] = field.data[pp + i * field.var_strides[0]];
                 }
             }
             break;
-        case 2:
-            for ( idx_t p = 0; p < sendcnt; ++p ) {
+        }
+        case 2: {
+            const idx_t ni = field.var_shape[0];
+            const idx_t nj = field.var_shape[1];
+            atlas_omp_parallel_for( idx_t p = 0; p < sendcnt; ++p ) {
                 const idx_t pp = send_stride * sendmap[p];
-                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                idx_t ibuf     = p * ni * nj;
+                for ( idx_t i = 0; i < ni; ++i ) {
                     const idx_t ii = pp + i * field.var_strides[0];
-                    for ( idx_t j = 0; j < field.var_shape[1]; ++j ) {
+                    for ( idx_t j = 0; j < nj; ++j ) {
                         send_buffer[ibuf++] = field.data[ii + j * field.var_strides[1]];
                     }
                 }
             }
             break;
-        case 3:
-            for ( idx_t p = 0; p < sendcnt; ++p ) {
+        }
+        case 3: {
+            const idx_t ni = field.var_shape[0];
+            const idx_t nj = field.var_shape[1];
+            const idx_t nk = field.var_shape[2];
+            atlas_omp_parallel_for( idx_t p = 0; p < sendcnt; ++p ) {
                 const idx_t pp = send_stride * sendmap[p];
-                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                idx_t ibuf     = p * ni * nj * nk;
+                for ( idx_t i = 0; i < ni; ++i ) {
                     const idx_t ii = pp + i * field.var_strides[0];
-                    for ( idx_t j = 0; j < field.var_shape[1]; ++j ) {
+                    for ( idx_t j = 0; j < nj; ++j ) {
                         const idx_t jj = ii + j * field.var_strides[1];
-                        for ( idx_t k = 0; k < field.var_shape[2]; ++k ) {
+                        for ( idx_t k = 0; k < nk; ++k ) {
                             send_buffer[ibuf++] = field.data[jj + k * field.var_strides[2]];
                         }
                     }
                 }
             }
             break;
+        }
         default:
             ATLAS_NOTIMPLEMENTED;
     }
 }
 
 template <typename DATA_TYPE>
-void GatherScatter::unpack_recv_buffer( const std::vector<int>& recvmap, const DATA_TYPE recv_buffer[],
+void GatherScatter::unpack_recv_buffer( const int recvmap[], const idx_t recvcnt, const DATA_TYPE recv_buffer[],
                                         const parallel::Field<DATA_TYPE>& field ) const {
-    const idx_t recvcnt = static_cast<idx_t>( recvmap.size() );
-
-    int ibuf                = 0;
     const idx_t recv_stride = field.var_strides[0] * field.var_shape[0];
 
     switch ( field.var_rank ) {
-        case 1:
-            for ( idx_t p = 0; p < recvcnt; ++p ) {
+        case 1: {
+            const idx_t ni = field.var_shape[0];
+            atlas_omp_parallel_for( idx_t p = 0; p < recvcnt; ++p ) {
                 const idx_t pp = recv_stride * recvmap[p];
-                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                idx_t ibuf     = p * ni;
+                for ( idx_t i = 0; i < ni; ++i ) {
                     field.data[pp + i * field.var_strides[0]] = recv_buffer[ibuf++];
                 }
             }
             break;
-        case 2:
-            for ( idx_t p = 0; p < recvcnt; ++p ) {
+        }
+        case 2: {
+            const idx_t ni = field.var_shape[0];
+            const idx_t nj = field.var_shape[1];
+            atlas_omp_parallel_for( idx_t p = 0; p < recvcnt; ++p ) {
                 const idx_t pp = recv_stride * recvmap[p];
-                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                idx_t ibuf     = p * ni * nj;
+                for ( idx_t i = 0; i < ni; ++i ) {
                     const idx_t ii = pp + i * field.var_strides[0];
-                    for ( idx_t j = 0; j < field.var_shape[1]; ++j ) {
+                    for ( idx_t j = 0; j < nj; ++j ) {
                         field.data[ii + j * field.var_strides[1]] = recv_buffer[ibuf++];
                     }
                 }
             }
             break;
-        case 3:
-            for ( idx_t p = 0; p < recvcnt; ++p ) {
+        }
+        case 3: {
+            const idx_t ni = field.var_shape[0];
+            const idx_t nj = field.var_shape[1];
+            const idx_t nk = field.var_shape[2];
+            atlas_omp_parallel_for( idx_t p = 0; p < recvcnt; ++p ) {
                 const idx_t pp = recv_stride * recvmap[p];
-                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                idx_t ibuf     = p * ni * nj * nk;
+                for ( idx_t i = 0; i < ni; ++i ) {
                     const idx_t ii = pp + i * field.var_strides[0];
-                    for ( idx_t j = 0; j < field.var_shape[1]; ++j ) {
+                    for ( idx_t j = 0; j < nj; ++j ) {
                         const idx_t jj = ii + j * field.var_strides[1];
-                        for ( idx_t k = 0; k < field.var_shape[2]; ++k ) {
+                        for ( idx_t k = 0; k < nk; ++k ) {
                             field.data[jj + k * field.var_strides[2]] = recv_buffer[ibuf++];
                         }
                     }
                 }
             }
             break;
+        }
         default:
             ATLAS_NOTIMPLEMENTED;
     }
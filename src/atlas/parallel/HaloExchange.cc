@@ -12,14 +12,18 @@
 /// @author Willem Deconinck
 /// @date   Nov 2013
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include "atlas/array/Array.h"
 #include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/runtime/Log.h"
 #include "atlas/util/vector.h"
 
 namespace atlas {
@@ -48,6 +52,126 @@ struct IsGhostPoint {
     const idx_t* ridx_;
     idx_t base_;
 };
+
+// Plans for aggregated exchanges of multiple arrays operate on raw bytes
+constexpr array::DataType::kind_t KIND_BYTES = 0;
+
+template <int RANK, typename Functor>
+void dispatch_datatype( array::Array& array, Functor& functor ) {
+    switch ( array.datatype().kind() ) {
+        case array::DataType::KIND_INT32:
+            functor.template apply<int, RANK>( array );
+            break;
+        case array::DataType::KIND_INT64:
+            functor.template apply<long, RANK>( array );
+            break;
+        case array::DataType::KIND_REAL32:
+            functor.template apply<float, RANK>( array );
+            break;
+        case array::DataType::KIND_REAL64:
+            functor.template apply<double, RANK>( array );
+            break;
+        default:
+            throw_Exception( "datatype not supported", Here() );
+    }
+}
+
+template <typename Functor>
+void dispatch_array( array::Array& array, Functor& functor ) {
+    switch ( array.rank() ) {
+        case 1:
+            dispatch_datatype<1>( array, functor );
+            break;
+        case 2:
+            dispatch_datatype<2>( array, functor );
+            break;
+        case 3:
+            dispatch_datatype<3>( array, functor );
+            break;
+        case 4:
+            dispatch_datatype<4>( array, functor );
+            break;
+        default:
+            throw_Exception( "Rank not supported", Here() );
+    }
+}
+
+/// Throw if an array cannot be packed by PackArray, before any message is posted
+void check_array( const array::Array& array, idx_t parsize ) {
+    if ( array.rank() < 1 || array.rank() > 4 ) {
+        throw_Exception( "Rank " + std::to_string( array.rank() ) + " not supported", Here() );
+    }
+    switch ( array.datatype().kind() ) {
+        case array::DataType::KIND_INT32:
+        case array::DataType::KIND_INT64:
+        case array::DataType::KIND_REAL32:
+        case array::DataType::KIND_REAL64:
+            break;
+        default:
+            throw_Exception( "datatype " + array.datatype().str() + " not supported", Here() );
+    }
+    if ( array.shape( 0 ) < parsize ) {
+        throw_Exception( "First dimension of array (" + std::to_string( array.shape( 0 ) ) +
+                             ") is smaller than the size of the halo exchange (" + std::to_string( parsize ) + ")",
+                         Here() );
+    }
+}
+
+struct ExecuteArray {
+    const HaloExchange& halo_exchange;
+    bool on_device;
+    template <typename DATA_TYPE, int RANK>
+    void apply( array::Array& array ) {
+        halo_exchange.execute<DATA_TYPE, RANK>( array, on_device );
+    }
+};
+
+/// Pack one array into the segments of an aggregated buffer. The segment for each task contains
+/// the data of all arrays one after the other; "offset" is the number of bytes per point of all
+/// arrays preceding this one.
+struct PackArray {
+    const array::SVector<int>& map;
+    const std::vector<int>& counts;
+    const std::vector<int>& displs;
+    const std::vector<int>& buffer_displs;
+    size_t offset;
+    char* buffer;
+    template <typename DATA_TYPE, int RANK>
+    void apply( array::Array& array ) {
+        auto field = array::make_host_view<DATA_TYPE, RANK>( array );
+        for ( size_t jproc = 0; jproc < counts.size(); ++jproc ) {
+            DATA_TYPE* send_buffer =
+                reinterpret_cast<DATA_TYPE*>( buffer + buffer_displs[jproc] + counts[jproc] * offset );
+            idx_t ibuf = 0;
+            for ( int node_cnt = displs[jproc]; node_cnt < displs[jproc] + counts[jproc]; ++node_cnt ) {
+                halo_packer_impl<0, RANK, 0>::apply( ibuf, map[node_cnt], field, send_buffer );
+            }
+        }
+    }
+};
+
+/// Inverse of PackArray
+struct UnpackArray {
+    const array::SVector<int>& map;
+    const std::vector<int>& counts;
+    const std::vector<int>& displs;
+    const std::vector<int>& buffer_displs;
+    size_t offset;
+    const char* buffer;
+    template <typename DATA_TYPE, int RANK>
+    void apply( array::Array& array ) {
+        auto field = array::make_host_view<DATA_TYPE, RANK>( array );
+        for ( size_t jproc = 0; jproc < counts.size(); ++jproc ) {
+            const DATA_TYPE* recv_buffer =
+                reinterpret_cast<const DATA_TYPE*>( buffer + buffer_displs[jproc] + counts[jproc] * offset );
+            idx_t ibuf = 0;
+            for ( int node_cnt = displs[jproc]; node_cnt < displs[jproc] + counts[jproc]; ++node_cnt ) {
+                halo_unpacker_impl<0, RANK, 0>::apply( ibuf, map[node_cnt], recv_buffer, field );
+            }
+        }
+    }
+};
+
 }  // namespace
 
 HaloExchange::HaloExchange() : name_(), is_setup_( false ) {
@@ -70,6 +194,8 @@ void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int
                           idx_t halo_begin ) {
     ATLAS_TRACE( "HaloExchange::setup" );
 
+    plans_.clear();
+
     parsize_ = parsize;
     sendcounts_.resize( nproc );
     sendcounts_.assign( nproc, 0 );
@@ -160,6 +286,169 @@ void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int
     backdoor.parsize = parsize_;
 }
 
+HaloExchange::Plan::Plan( idx_t var_size, size_t bytes_per_value, bool _on_device, bool adjoint,
+                          const HaloExchange& halo_exchange ) :
+    on_device( _on_device ) {
+    std::size_t nproc_loc( static_cast<std::size_t>( halo_exchange.nproc ) );
+    send_counts_init.resize( nproc_loc );
+    recv_counts_init.resize( nproc_loc );
+    send_counts.resize( nproc_loc );
+    recv_counts.resize( nproc_loc );
+    send_displs.resize( nproc_loc );
+    recv_displs.resize( nproc_loc );
+    send_req.resize( nproc_loc );
+    recv_req.resize( nproc_loc );
+
+    if ( not adjoint ) {
+        send_size = halo_exchange.sendcnt_ * var_size;
+        recv_size = halo_exchange.recvcnt_ * var_size;
+        halo_exchange.counts_displs_setup<char>( var_size, send_counts_init, recv_counts_init, send_counts,
+                                                 recv_counts, send_displs, recv_displs );
+    }
+    else {
+        // Adjoint communication flows in the opposite direction
+        send_size = halo_exchange.recvcnt_ * var_size;
+        recv_size = halo_exchange.sendcnt_ * var_size;
+        halo_exchange.counts_displs_setup<char>( var_size, recv_counts_init, send_counts_init, recv_counts,
+                                                 send_counts, recv_displs, send_displs );
+    }
+
+    send_buffer_ = halo_exchange.allocate_buffer<char>( send_size * bytes_per_value, on_device );
+    recv_buffer_ = halo_exchange.allocate_buffer<char>( recv_size * bytes_per_value, on_device );
+}
+
+HaloExchange::Plan::~Plan() {
+    if ( on_device ) {
+        util::delete_devicemem( send_buffer_ );
+        util::delete_devicemem( recv_buffer_ );
+    }
+    else {
+        util::delete_hostmem( send_buffer_ );
+        util::delete_hostmem( recv_buffer_ );
+    }
+}
+
+HaloExchange::Plan& HaloExchange::acquire_plan( array::DataType::kind_t datatype, size_t bytes_per_value,
+                                                idx_t var_size, bool on_device, bool adjoint ) const {
+    auto& plans = plans_[PlanKey{datatype, var_size, on_device, adjoint}];
+    for ( auto& plan : plans ) {
+        if ( not plan->in_use ) {
+            plan->in_use = true;
+            return *plan;
+        }
+    }
+    ATLAS_TRACE( "HaloExchange::Plan" );
+    plans.emplace_back( new Plan( var_size, bytes_per_value, on_device, adjoint, *this ) );
+    plans.back()->in_use = true;
+    return *plans.back();
+}
+
+void HaloExchange::execute( const std::vector<array::Array*>& arrays, bool on_device ) const {
+    if ( on_device || arrays.size() == 1 ) {
+        // Packing of multiple arrays is only implemented on the host
+        ExecuteArray execute_array{*this, on_device};
+        for ( auto* array : arrays ) {
+            dispatch_array( *array, execute_array );
+        }
+        return;
+    }
+    execute_start( arrays ).wait();
+}
+
+HaloExchangeHandle HaloExchange::execute_start( const std::vector<array::Array*>& arrays ) const {
+    ATLAS_TRACE( "HaloExchange", {"halo-exchange"} );
+    if ( !is_setup_ ) {
+        throw_Exception( "HaloExchange was not setup", Here() );
+    }
+
+    HaloExchangeHandle handle;
+    if ( arrays.empty() ) {
+        return handle;
+    }
+    for ( const auto* array : arrays ) {
+        check_array( *array, parsize_ );
+    }
+    handle.halo_exchange_ = this;
+    handle.arrays_        = arrays;
+
+    // Order arrays by decreasing size of data type, so that the data of each array within
+    // the aggregated buffer remains aligned
+    std::vector<size_t> order( arrays.size() );
+    std::iota( order.begin(), order.end(), 0 );
+    std::stable_sort( order.begin(), order.end(), [&]( size_t a, size_t b ) {
+        return arrays[a]->datatype().size() > arrays[b]->datatype().size();
+    } );
+
+    auto& offsets = handle.offsets_;
+    offsets.resize( arrays.size() );
+    size_t bytes_per_point = 0;
+    for ( size_t j : order ) {
+        const array::Array& array = *arrays[j];
+        idx_t var_size            = 1;
+        for ( idx_t d = 1; d < array.rank(); ++d ) {
+            var_size *= array.shape( d );
+        }
+        offsets[j] = bytes_per_point;
+        bytes_per_point += var_size * array.datatype().size();
+    }
+    const size_t alignment = arrays[order.front()]->datatype().size();
+    bytes_per_point        = ( ( bytes_per_point + alignment - 1 ) / alignment ) * alignment;
+
+    int tag( 1 );
+    PlanLock plan( acquire_plan( KIND_BYTES, 1, static_cast<idx_t>( bytes_per_point ), false, false ) );
+
+    char* inner_buffer = plan->send_buffer<char>();
+    char* halo_buffer  = plan->recv_buffer<char>();
+
+    /// Pack, before posting any message, so that a failure leaves no pending communication
+    {
+        ATLAS_TRACE( "pack_send_buffer" );
+        for ( size_t j = 0; j < arrays.size(); ++j ) {
+            PackArray pack{sendmap_, sendcounts_, senddispls_, plan->send_displs, offsets[j], inner_buffer};
+            dispatch_array( *arrays[j], pack );
+        }
+    }
+
+    ireceive<char>( tag, plan->recv_displs, plan->recv_counts, plan->recv_req, halo_buffer );
+    isend<char>( tag, plan->send_displs, plan->send_counts, plan->send_req, inner_buffer );
+
+    // The exchange is now in progress: the plan remains in use until the handle is waited for
+    handle.plan_ = plan.release();
+    return handle;
+}
+
+void HaloExchange::execute_wait( HaloExchangeHandle& handle ) const {
+    ATLAS_TRACE( "HaloExchange", {"halo-exchange"} );
+
+    PlanLock plan( *handle.plan_ );
+    handle.plan_ = nullptr;
+
+    wait_for_receive( plan->recv_counts_init, plan->recv_req );
+
+    /// Unpack
+    {
+        ATLAS_TRACE( "unpack_recv_buffer" );
+        const char* halo_buffer = plan->recv_buffer<char>();
+        for ( size_t j = 0; j < handle.arrays_.size(); ++j ) {
+            UnpackArray unpack{recvmap_, recvcounts_, recvdispls_, plan->recv_displs, handle.offsets_[j], halo_buffer};
+            dispatch_array( *handle.arrays_[j], unpack );
+        }
+    }
+
+    wait_for_send( plan->send_counts_init, plan->send_req );
+}
+
+void HaloExchange::wait_for_receive( std::vector<int>& recv_counts_init,
+                                     std::vector<eckit::mpi::Request>& recv_req ) const {
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+        for ( int jproc = 0; jproc < nproc; ++jproc ) {
+            if ( recv_counts_init[jproc] > 0 ) {
+                mpi::comm().wait( recv_req[jproc] );
+            }
+        }
+    }
+}
+
 void HaloExchange::wait_for_send( std::vector<int>& send_counts_init,
                                   std::vector<eckit::mpi::Request>& send_req ) const {
     ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
@@ -171,6 +460,63 @@ void HaloExchange::wait_for_send( std::vector<int>& send_counts_init,
     }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+
+HaloExchangeHandle::HaloExchangeHandle( HaloExchangeHandle&& other ) :
+    halo_exchange_( other.halo_exchange_ ),
+    plan_( other.plan_ ),
+    arrays_( std::move( other.arrays_ ) ),
+    offsets_( std::move( other.offsets_ ) ),
+    on_completion_( std::move( other.on_completion_ ) ) {
+    other.plan_ = nullptr;
+    other.on_completion_.clear();
+}
+
+HaloExchangeHandle& HaloExchangeHandle::operator=( HaloExchangeHandle&& other ) {
+    if ( this != &other ) {
+        wait();
+        halo_exchange_ = other.halo_exchange_;
+        plan_          = other.plan_;
+        arrays_        = std::move( other.arrays_ );
+        offsets_       = std::move( other.offsets_ );
+        on_completion_ = std::move( other.on_completion_ );
+        other.plan_    = nullptr;
+        other.on_completion_.clear();
+    }
+    return *this;
+}
+
+HaloExchangeHandle::~HaloExchangeHandle() {
+    try {
+        wait();
+    }
+    catch ( const std::exception& e ) {
+        Log::error() << "HaloExchangeHandle: exchange could not be completed: " << e.what() << std::endl;
+    }
+}
+
+void HaloExchangeHandle::wait() {
+    if ( plan_ ) {
+        halo_exchange_->execute_wait( *this );
+    }
+    std::vector<std::function<void()>> on_completion;
+    std::swap( on_completion, on_completion_ );
+    for ( auto& action : on_completion ) {
+        action();
+    }
+}
+
+void HaloExchangeHandle::on_completion( std::function<void()> action ) {
+    if ( plan_ ) {
+        on_completion_.emplace_back( std::move( action ) );
+    }
+    else {
+        action();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 namespace {
 
 template <typename Value>
@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "atlas/parallel/HaloAdjointExchangeImpl.h"
@@ -26,6 +30,7 @@
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/ArrayViewDefs.h"
 #include "atlas/array/ArrayViewUtil.h"
+#include "atlas/array/DataType.h"
 #include "atlas/array/SVector.h"
 #include "atlas/array_fwd.h"
 #include "atlas/library/config.h"
@@ -40,6 +45,8 @@
 namespace atlas {
 namespace parallel {
 
+class HaloExchangeHandle;
+
 class HaloExchange : public util::Object {
 public:
     HaloExchange();
@@ -60,7 +67,93 @@ public:  // methods
     template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
     void execute_adjoint( array::Array& field, bool on_device = false ) const;
 
+    /// Exchange halos of multiple arrays at once, packing all arrays in a single message per
+    /// neighbouring task. Arrays may differ in data type and rank, but their parallel dimension
+    /// must be the first dimension.
+    void execute( const std::vector<array::Array*>& arrays, bool on_device = false ) const;
+
+    /// Start a halo exchange of multiple host arrays without waiting for its completion.
+    /// Halo values are only valid after calling wait() on the returned handle, so that work not
+    /// depending on halo values can overlap with the communication.
+    /// Exchanges must be started in the same order on all tasks.
+    HaloExchangeHandle execute_start( const std::vector<array::Array*>& arrays ) const;
+
+private:  // types
+    friend class HaloExchangeHandle;
+
+    /// Communication plan for one combination of data type, var_size, memory space and direction.
+    /// It holds pre-sized send/receive buffers, counts, displacements and request vectors, so that
+    /// repeated exchanges of fields with the same shape do not allocate nor recompute any setup.
+    struct Plan {
+        Plan( idx_t var_size, size_t bytes_per_value, bool on_device, bool adjoint, const HaloExchange& );
+        Plan( const Plan& ) = delete;
+        Plan& operator=( const Plan& ) = delete;
+        ~Plan();
+
+        template <typename DATA_TYPE>
+        DATA_TYPE* send_buffer() const {
+            return reinterpret_cast<DATA_TYPE*>( send_buffer_ );
+        }
+        template <typename DATA_TYPE>
+        DATA_TYPE* recv_buffer() const {
+            return reinterpret_cast<DATA_TYPE*>( recv_buffer_ );
+        }
+
+        std::vector<int> send_counts_init;
+        std::vector<int> recv_counts_init;
+        std::vector<int> send_counts;
+        std::vector<int> recv_counts;
+        std::vector<int> send_displs;
+        std::vector<int> recv_displs;
+        std::vector<eckit::mpi::Request> send_req;
+        std::vector<eckit::mpi::Request> recv_req;
+        int send_size;  // in values
+        int recv_size;  // in values
+        bool on_device;
+        bool in_use{false};
+
+    private:
+        char* send_buffer_{nullptr};
+        char* recv_buffer_{nullptr};
+    };
+
+    using PlanKey = std::tuple<array::DataType::kind_t, idx_t, bool, bool>;
+
+    /// RAII guard marking a plan as in use for the duration of one exchange
+    class PlanLock {
+    public:
+        PlanLock( Plan& plan ) : plan_( &plan ) {}
+        PlanLock( const PlanLock& ) = delete;
+        PlanLock& operator=( const PlanLock& ) = delete;
+        ~PlanLock() {
+            if ( plan_ ) {
+                plan_->in_use = false;
+            }
+        }
+        Plan& operator*() const { return *plan_; }
+        Plan* operator->() const { return plan_; }
+
+        /// Keep the plan in use beyond the lifetime of this guard
+        Plan* release() {
+            Plan* plan = plan_;
+            plan_      = nullptr;
+            return plan;
+        }
+
+    private:
+        Plan* plan_;
+    };
+
 private:  // methods
+    /// Return a plan which is not in use for given key, creating one if needed.
+    Plan& acquire_plan( array::DataType::kind_t, size_t bytes_per_value, idx_t var_size, bool on_device,
+                        bool adjoint ) const;
+
+    template <typename DATA_TYPE>
+    Plan& acquire_plan( idx_t var_size, bool on_device, bool adjoint ) const {
+        return acquire_plan( array::DataType::kind<DATA_TYPE>(), sizeof( DATA_TYPE ), var_size, on_device, adjoint );
+    }
+
     idx_t index( idx_t i, idx_t j, idx_t k, idx_t ni, idx_t nj, idx_t /*nk*/ ) const {
         return ( i + ni * ( j + nj * k ) );
     }
@@ -78,6 +171,14 @@ private:  // methods
     void ireceive( int tag, std::vector<int>& recv_displs, std::vector<int>& recv_counts,
                    std::vector<eckit::mpi::Request>& recv_req, DATA_TYPE* recv_buffer ) const;
 
+    template <typename DATA_TYPE>
+    void isend( int tag, std::vector<int>& send_displs, std::vector<int>& send_counts,
+                std::vector<eckit::mpi::Request>& send_req, DATA_TYPE* send_buffer ) const;
+
+    void wait_for_receive( std::vector<int>& recv_counts_init, std::vector<eckit::mpi::Request>& recv_req ) const;
+
+    void execute_wait( HaloExchangeHandle& ) const;
+
     template <typename DATA_TYPE>
     void isend_and_wait_for_receive( int tag, std::vector<int>& recv_counts_init,
                                      std::vector<eckit::mpi::Request>& recv_req, std::vector<int>& send_displs,
@@ -137,12 +238,45 @@ private:  // data
     int nproc;
     int myproc;
 
+    mutable std::map<PlanKey, std::vector<std::unique_ptr<Plan>>> plans_;
+
 public:
     struct Backdoor {
         int parsize;
     } backdoor;
 };
 
+/// Handle to a halo exchange in progress, returned by HaloExchange::execute_start().
+/// The destructor waits for completion if wait() was not called before; errors during this
+/// wait are logged, as they cannot be thrown from a destructor.
+class HaloExchangeHandle {
+public:
+    HaloExchangeHandle() = default;
+    HaloExchangeHandle( HaloExchangeHandle&& );
+    HaloExchangeHandle& operator=( HaloExchangeHandle&& );
+    HaloExchangeHandle( const HaloExchangeHandle& ) = delete;
+    HaloExchangeHandle& operator=( const HaloExchangeHandle& ) = delete;
+    ~HaloExchangeHandle();
+
+    /// Wait for the exchange to complete and unpack the received halo values
+    void wait();
+
+    /// True while the exchange has been started and not yet completed
+    bool active() const { return plan_ != nullptr; }
+
+    /// Register an action to be performed after completion of the exchange.
+    /// If the exchange is not active, the action is performed immediately.
+    void on_completion( std::function<void()> );
+
+private:
+    friend class HaloExchange;
+    const HaloExchange* halo_exchange_{nullptr};
+    HaloExchange::Plan* plan_{nullptr};
+    std::vector<array::Array*> arrays_;
+    std::vector<size_t> offsets_;
+    std::vector<std::function<void()>> on_completion_;
+};
+
 template <typename DATA_TYPE, int RANK, typename ParallelDim>
 void HaloExchange::execute( array::Array& field, bool on_device ) const {
     ATLAS_TRACE( "HaloExchange", {"halo-exchange"} );
@@ -158,35 +292,23 @@ void HaloExchange::execute( array::Array& field, bool on_device ) const {
     idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
 
     int tag( 1 );
-    std::size_t nproc_loc( static_cast<std::size_t>( nproc ) );
-    std::vector<int> inner_counts( nproc_loc ), halo_counts( nproc_loc );
-    std::vector<int> inner_counts_init( nproc_loc ), halo_counts_init( nproc_loc );
-    std::vector<int> inner_displs( nproc_loc ), halo_displs( nproc_loc );
-    std::vector<eckit::mpi::Request> inner_req( nproc_loc ), halo_req( nproc_loc );
-
-    int inner_size          = sendcnt_ * var_size;
-    int halo_size           = recvcnt_ * var_size;
-    DATA_TYPE* inner_buffer = allocate_buffer<DATA_TYPE>( inner_size, on_device );
-    DATA_TYPE* halo_buffer  = allocate_buffer<DATA_TYPE>( halo_size, on_device );
+    PlanLock plan( acquire_plan<DATA_TYPE>( var_size, on_device, false ) );
 
-    counts_displs_setup<DATA_TYPE>( var_size, inner_counts_init, halo_counts_init, inner_counts, halo_counts,
-                                    inner_displs, halo_displs );
+    DATA_TYPE* inner_buffer = plan->send_buffer<DATA_TYPE>();
+    DATA_TYPE* halo_buffer  = plan->recv_buffer<DATA_TYPE>();
 
-    ireceive<DATA_TYPE>( tag, halo_displs, halo_counts, halo_req, halo_buffer );
+    ireceive<DATA_TYPE>( tag, plan->recv_displs, plan->recv_counts, plan->recv_req, halo_buffer );
 
     /// Pack
-    pack_send_buffer<parallelDim>( field_hv, field_dv, inner_buffer, inner_size, on_device );
+    pack_send_buffer<parallelDim>( field_hv, field_dv, inner_buffer, plan->send_size, on_device );
 
-    isend_and_wait_for_receive<DATA_TYPE>( tag, halo_counts_init, halo_req, inner_displs, inner_counts, inner_req,
-                                           inner_buffer );
+    isend_and_wait_for_receive<DATA_TYPE>( tag, plan->recv_counts_init, plan->recv_req, plan->send_displs,
+                                           plan->send_counts, plan->send_req, inner_buffer );
 
     /// Unpack
-    unpack_recv_buffer<parallelDim>( halo_buffer, halo_size, field_hv, field_dv, on_device );
+    unpack_recv_buffer<parallelDim>( halo_buffer, plan->recv_size, field_hv, field_dv, on_device );
 
-    wait_for_send( inner_counts_init, inner_req );
-
-    deallocate_buffer<DATA_TYPE>( inner_buffer, on_device );
-    deallocate_buffer<DATA_TYPE>( halo_buffer, on_device );
+    wait_for_send( plan->send_counts_init, plan->send_req );
 }
 
 template <typename DATA_TYPE, int RANK, typename ParallelDim>
@@ -205,39 +327,27 @@ void HaloExchange::execute_adjoint( array::Array& field, bool on_device ) const
     idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
 
     int tag( 1 );
-    std::size_t nproc_loc( static_cast<std::size_t>( nproc ) );
-    std::vector<int> halo_counts( nproc_loc ), inner_counts( nproc_loc );
-    std::vector<int> halo_counts_init( nproc_loc ), inner_counts_init( nproc_loc );
-    std::vector<int> halo_displs( nproc_loc ), inner_displs( nproc_loc );
-    std::vector<eckit::mpi::Request> halo_req( nproc_loc ), inner_req( nproc_loc );
-
-    int halo_size           = sendcnt_ * var_size;
-    int inner_size          = recvcnt_ * var_size;
-    DATA_TYPE* halo_buffer  = allocate_buffer<DATA_TYPE>( halo_size, on_device );
-    DATA_TYPE* inner_buffer = allocate_buffer<DATA_TYPE>( inner_size, on_device );
+    PlanLock plan( acquire_plan<DATA_TYPE>( var_size, on_device, true ) );
 
-    counts_displs_setup<DATA_TYPE>( var_size, halo_counts_init, inner_counts_init, halo_counts, inner_counts,
-                                    halo_displs, inner_displs );
+    DATA_TYPE* inner_buffer = plan->send_buffer<DATA_TYPE>();
+    DATA_TYPE* halo_buffer  = plan->recv_buffer<DATA_TYPE>();
 
-    ireceive<DATA_TYPE>( tag, halo_displs, halo_counts, halo_req, halo_buffer );
+    ireceive<DATA_TYPE>( tag, plan->recv_displs, plan->recv_counts, plan->recv_req, halo_buffer );
 
     /// Pack
-    pack_recv_adjoint_buffer<parallelDim>( field_hv, field_dv, inner_buffer, inner_size, on_device );
+    pack_recv_adjoint_buffer<parallelDim>( field_hv, field_dv, inner_buffer, plan->send_size, on_device );
 
     /// Send
-    isend_and_wait_for_receive<DATA_TYPE>( tag, halo_counts_init, halo_req, inner_displs, inner_counts, inner_req,
-                                           inner_buffer );
+    isend_and_wait_for_receive<DATA_TYPE>( tag, plan->recv_counts_init, plan->recv_req, plan->send_displs,
+                                           plan->send_counts, plan->send_req, inner_buffer );
 
     /// Unpack
-    unpack_send_adjoint_buffer<parallelDim>( halo_buffer, halo_size, field_hv, field_dv, on_device );
+    unpack_send_adjoint_buffer<parallelDim>( halo_buffer, plan->recv_size, field_hv, field_dv, on_device );
 
     /// Wait for sending to finish
-    wait_for_send( inner_counts_init, inner_req );
-
-    zero_halos<parallelDim>( field_hv, field_dv, halo_buffer, halo_size, on_device );
+    wait_for_send( plan->send_counts_init, plan->send_req );
 
-    deallocate_buffer<DATA_TYPE>( halo_buffer, on_device );
-    deallocate_buffer<DATA_TYPE>( inner_buffer, on_device );
+    zero_halos<parallelDim>( field_hv, field_dv, halo_buffer, plan->recv_size, on_device );
 }
 
 template <typename DATA_TYPE>
@@ -296,12 +406,8 @@ void HaloExchange::ireceive( int tag, std::vector<int>& recv_displs, std::vector
 }
 
 template <typename DATA_TYPE>
-void HaloExchange::isend_and_wait_for_receive( int tag, std::vector<int>& recv_counts_init,
-                                               std::vector<eckit::mpi::Request>& recv_req,
-                                               std::vector<int>& send_displs, std::vector<int>& send_counts,
-                                               std::vector<eckit::mpi::Request>& send_req,
-                                               DATA_TYPE* send_buffer ) const {
-    /// Send
+void HaloExchange::isend( int tag, std::vector<int>& send_displs, std::vector<int>& send_counts,
+                          std::vector<eckit::mpi::Request>& send_req, DATA_TYPE* send_buffer ) const {
     ATLAS_TRACE_MPI( ISEND ) {
         for ( size_t jproc = 0; jproc < static_cast<size_t>( nproc ); ++jproc ) {
             if ( send_counts[jproc] > 0 ) {
@@ -309,15 +415,19 @@ void HaloExchange::isend_and_wait_for_receive( int tag, std::vector<int>& recv_c
             }
         }
     }
+}
+
+template <typename DATA_TYPE>
+void HaloExchange::isend_and_wait_for_receive( int tag, std::vector<int>& recv_counts_init,
+                                               std::vector<eckit::mpi::Request>& recv_req,
+                                               std::vector<int>& send_displs, std::vector<int>& send_counts,
+                                               std::vector<eckit::mpi::Request>& send_req,
+                                               DATA_TYPE* send_buffer ) const {
+    /// Send
+    isend<DATA_TYPE>( tag, send_displs, send_counts, send_req, send_buffer );
 
     /// Wait for receiving to finish
-    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
-        for ( size_t jproc = 0; jproc < static_cast<size_t>( nproc ); ++jproc ) {
-            if ( recv_counts_init[jproc] > 0 ) {
-                mpi::comm().wait( recv_req[jproc] );
-            }
-        }
-    }
+    wait_for_receive( recv_counts_init, recv_req );
 }
 
 template <int ParallelDim, int RANK>
@@ -50,6 +50,14 @@ void atlas::Projection::lonlat2xy( Point2& point ) const {
     return get()->lonlat2xy( point );
 }
 
+void atlas::Projection::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    return get()->xy2lonlat( xy, lonlat, n, stride );
+}
+
+void atlas::Projection::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    return get()->lonlat2xy( lonlat, xy, n, stride );
+}
+
 atlas::Projection::Jacobian atlas::Projection::jacobian( const PointLonLat& p ) const {
     return get()->jacobian( p );
 }
@@ -64,6 +64,11 @@ public:
     void lonlat2xy( double crd[] ) const;
     void lonlat2xy( Point2& ) const;
 
+    /// @brief Project n points at once, which is much faster than projecting point by point.
+    /// Coordinates of point j are at index j*stride and j*stride+1. Input and output may be the same array.
+    void xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride = 2 ) const;
+    void lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride = 2 ) const;
+
     Jacobian jacobian( const PointLonLat& ) const;
 
     PointLonLat lonlat( const PointXY& ) const;
@@ -86,6 +86,16 @@ void LambertAzimuthalEqualAreaProjection::xy2lonlat( double crd[] ) const {
 }
 
 
+void LambertAzimuthalEqualAreaProjection::xy2lonlat( const double xy[], double lonlat[], size_t n,
+                                                     size_t stride ) const {
+    transform( xy, lonlat, n, stride, [this]( double crd[] ) { xy2lonlat( crd ); } );
+}
+
+void LambertAzimuthalEqualAreaProjection::lonlat2xy( const double lonlat[], double xy[], size_t n,
+                                                     size_t stride ) const {
+    transform( lonlat, xy, n, stride, [this]( double crd[] ) { lonlat2xy( crd ); } );
+}
+
 ProjectionImpl::Jacobian LambertAzimuthalEqualAreaProjection::jacobian( const PointLonLat& ) const {
     throw_NotImplemented( "LambertAzimuthalEqualAreaProjection::jacobian", Here() );
 }
@@ -100,6 +100,14 @@ void LambertConformalConicProjection::xy2lonlat( double crd[] ) const {
             : util::Constants::radiansToDegrees() * 2. * std::atan( std::pow( radius_ * F_ / rho, inv_n_ ) ) - 90.;
 }
 
+void LambertConformalConicProjection::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    transform( xy, lonlat, n, stride, [this]( double crd[] ) { xy2lonlat( crd ); } );
+}
+
+void LambertConformalConicProjection::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    transform( lonlat, xy, n, stride, [this]( double crd[] ) { lonlat2xy( crd ); } );
+}
+
 ProjectionImpl::Jacobian LambertConformalConicProjection::jacobian( const PointLonLat& lonlat ) const {
     ProjectionImpl::Jacobian jac;
 
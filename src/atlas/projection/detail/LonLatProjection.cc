@@ -35,6 +35,30 @@ void LonLatProjectionT<NotRotated>::xy2lonlat( double[] ) const {}
 template <>
 void LonLatProjectionT<NotRotated>::lonlat2xy( double[] ) const {}
 
+template <>
+void LonLatProjectionT<NotRotated>::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    if ( lonlat != xy ) {
+        transform( xy, lonlat, n, stride, []( double[] ) {} );
+    }
+}
+
+template <>
+void LonLatProjectionT<NotRotated>::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    if ( xy != lonlat ) {
+        transform( lonlat, xy, n, stride, []( double[] ) {} );
+    }
+}
+
+template <typename Rotation>
+void LonLatProjectionT<Rotation>::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    transform( xy, lonlat, n, stride, [this]( double crd[] ) { xy2lonlat( crd ); } );
+}
+
+template <typename Rotation>
+void LonLatProjectionT<Rotation>::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    transform( lonlat, xy, n, stride, [this]( double crd[] ) { lonlat2xy( crd ); } );
+}
+
 template <>
 ProjectionImpl::Jacobian LonLatProjectionT<NotRotated>::jacobian( const PointLonLat& ) const {
     Jacobian jac;
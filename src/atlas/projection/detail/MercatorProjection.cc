@@ -153,6 +153,16 @@ void MercatorProjectionT<Rotation>::xy2lonlat( double crd[] ) const {
     normalise_( crd );
 }
 
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    transform( xy, lonlat, n, stride, [this]( double crd[] ) { xy2lonlat( crd ); } );
+}
+
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    transform( lonlat, xy, n, stride, [this]( double crd[] ) { lonlat2xy( crd ); } );
+}
+
 template <typename Rotation>
 ProjectionImpl::Jacobian MercatorProjectionT<Rotation>::jacobian( const PointLonLat& ) const {
     throw_NotImplemented( "MercatorProjectionT::jacobian", Here() );
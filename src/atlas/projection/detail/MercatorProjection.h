@@ -31,6 +31,8 @@ public:
     // projection and inverse projection
     void xy2lonlat( double crd[] ) const override;
     void lonlat2xy( double crd[] ) const override;
+    void xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const override;
+    void lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const override;
 
     Jacobian jacobian( const PointLonLat& ) const override;
 
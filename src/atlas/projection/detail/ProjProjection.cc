@@ -124,7 +124,10 @@ ProjProjection::ProjProjection( const eckit::Parametrisation& param ) :
 
 void ProjProjection::xy2lonlat( double crd[] ) const {
     PJ_COORD P = proj_coord( crd[XX], crd[YY], 0, 0 );
-    P          = proj_trans( sourceToTarget_, PJ_INV, P );
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        P = proj_trans( sourceToTarget_, PJ_INV, P );
+    }
 
     //    std::memcpy(crd, &P, 2 * sizeof(double));
     crd[LON] = P.enu.e;
@@ -136,7 +139,10 @@ void ProjProjection::xy2lonlat( double crd[] ) const {
 
 void ProjProjection::lonlat2xy( double crd[] ) const {
     PJ_COORD P = proj_coord( crd[LON], crd[LAT], 0, 0 );
-    P          = proj_trans( sourceToTarget_, PJ_FWD, P );
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        P = proj_trans( sourceToTarget_, PJ_FWD, P );
+    }
 
     //    std::memcpy(crd, &P, 2 * sizeof(double));
     crd[XX] = P.xy.x;
@@ -144,13 +150,49 @@ void ProjProjection::lonlat2xy( double crd[] ) const {
 }
 
 
+void ProjProjection::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    // PROJ transforms arrays of coordinates efficiently
+    if ( lonlat != xy ) {
+        transform( xy, lonlat, n, stride, []( double[] ) {} );
+    }
+    const size_t step = stride * sizeof( double );
+    double z          = 0.;
+    double t          = 0.;
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        proj_trans_generic( sourceToTarget_, PJ_INV, lonlat + LON, step, n, lonlat + LAT, step, n, &z, 0, 1, &t, 0,
+                            1 );
+    }
+    for ( size_t j = 0; j < n; ++j ) {
+        normalise_( lonlat + j * stride );
+    }
+}
+
+
+void ProjProjection::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    if ( xy != lonlat ) {
+        transform( lonlat, xy, n, stride, []( double[] ) {} );
+    }
+    const size_t step = stride * sizeof( double );
+    double z          = 0.;
+    double t          = 0.;
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        proj_trans_generic( sourceToTarget_, PJ_FWD, xy + XX, step, n, xy + YY, step, n, &z, 0, 1, &t, 0, 1 );
+    }
+}
+
+
 ProjectionImpl::Jacobian ProjProjection::jacobian( const PointLonLat& ) const {
     throw_NotImplemented( "ProjProjection::jacobian", Here() );
 }
 
 PointXYZ ProjProjection::xyz( const PointLonLat& lonlat ) const {
     PJ_COORD P = proj_coord( lonlat.lon(), lonlat.lat(), 0, 0 );
-    P          = proj_trans( sourceToGeocentric_, PJ_FWD, P );
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        P = proj_trans( sourceToGeocentric_, PJ_FWD, P );
+    }
     return {P.xyz.x, P.xyz.y, P.xyz.z};
 }
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "atlas/projection/detail/ProjectionImpl.h"
 #include "atlas/util/Config.h"
@@ -55,6 +56,8 @@ public:
 
     void xy2lonlat( double[] ) const override;
     void lonlat2xy( double[] ) const override;
+    void xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const override;
+    void lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const override;
 
     Jacobian jacobian( const PointLonLat& ) const override;
 
@@ -143,6 +146,9 @@ private:
     pj_t sourceToGeocentric_;
     ctx_t context_;
 
+    // PROJ objects are not thread-safe: calls are serialised, so that projections can be used from OpenMP loops
+    mutable std::mutex mutex_;
+
     Spec extraSpec_;
 
     // -- Methods
@@ -226,6 +226,13 @@ const ProjectionImpl* ProjectionImpl::create( const std::string& type, const eck
     return ProjectionFactory::build( type, p );
 }
 
+void ProjectionImpl::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    transform( xy, lonlat, n, stride, [this]( double crd[] ) { xy2lonlat( crd ); } );
+}
+
+void ProjectionImpl::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    transform( lonlat, xy, n, stride, [this]( double crd[] ) { lonlat2xy( crd ); } );
+}
 
 PointXYZ ProjectionImpl::xyz( const PointLonLat& lonlat ) const {
     atlas::PointXYZ xyz;
@@ -10,9 +10,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/util/Factory.h"
 #include "atlas/util/NormaliseLongitude.h"
 #include "atlas/util/Object.h"
@@ -160,6 +162,11 @@ public:
     virtual void xy2lonlat( double crd[] ) const = 0;
     virtual void lonlat2xy( double crd[] ) const = 0;
 
+    /// @brief Project n points at once
+    /// Coordinates of point j are at index j*stride and j*stride+1. Input and output may be the same array.
+    virtual void xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const;
+    virtual void lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const;
+
     virtual Jacobian jacobian( const PointLonLat& ) const = 0;
 
     void xy2lonlat( Point2& ) const;
@@ -180,6 +187,29 @@ public:
 
     virtual void hash( eckit::Hash& ) const = 0;
 
+protected:
+    /// @brief Apply a single point projection to n points, see xy2lonlat( xy, lonlat, n, stride ).
+    /// Projections are expected to implement the batched functions with this, passing a lambda that calls their
+    /// own (final) single point projection, so that the loop is free of virtual function calls.
+    template <typename Function>
+    static void transform( const double in[], double out[], size_t n, size_t stride, const Function& project ) {
+        auto transform_point = [&]( size_t j ) {
+            double crd[] = {in[j * stride], in[j * stride + 1]};
+            project( crd );
+            out[j * stride]     = crd[0];
+            out[j * stride + 1] = crd[1];
+        };
+        if ( n >= 1024 ) {
+            atlas_omp_parallel_for( size_t j = 0; j < n; ++j ) { transform_point( j ); }
+        }
+        else {
+            for ( size_t j = 0; j < n; ++j ) {
+                transform_point( j );
+            }
+        }
+    }
+
+public:
     struct BoundLonLat {
         operator RectangularLonLatDomain() const;
         void extend( PointLonLat p, PointLonLat eps );
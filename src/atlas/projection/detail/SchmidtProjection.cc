@@ -48,9 +48,8 @@ SchmidtProjectionT<Rotation>::SchmidtProjectionT() : ProjectionImpl(), rotation_
 
 template <typename Rotation>
 void SchmidtProjectionT<Rotation>::xy2lonlat( double crd[] ) const {
-    // stretch
-    crd[1] = R2D(
-        std::asin( std::cos( 2. * std::atan( 1 / c_ * std::tan( std::acos( std::sin( D2R( crd[1] ) ) ) * 0.5 ) ) ) ) );
+    // stretch: tan of half the colatitude is divided by c
+    crd[1] = 90. - 2. * R2D( std::atan( 1. / c_ * std::tan( D2R( 45. - 0.5 * crd[1] ) ) ) );
 
     // perform rotation
     rotation_.rotate( crd );
@@ -61,9 +60,18 @@ void SchmidtProjectionT<Rotation>::lonlat2xy( double crd[] ) const {
     // inverse rotation
     rotation_.unrotate( crd );
 
-    // unstretch
-    crd[1] =
-        R2D( std::asin( std::cos( 2. * std::atan( c_ * std::tan( std::acos( std::sin( D2R( crd[1] ) ) ) * 0.5 ) ) ) ) );
+    // unstretch: tan of half the colatitude is multiplied by c
+    crd[1] = 90. - 2. * R2D( std::atan( c_ * std::tan( D2R( 45. - 0.5 * crd[1] ) ) ) );
+}
+
+template <typename Rotation>
+void SchmidtProjectionT<Rotation>::xy2lonlat( const double xy[], double lonlat[], size_t n, size_t stride ) const {
+    transform( xy, lonlat, n, stride, [this]( double crd[] ) { xy2lonlat( crd ); } );
+}
+
+template <typename Rotation>
+void SchmidtProjectionT<Rotation>::lonlat2xy( const double lonlat[], double xy[], size_t n, size_t stride ) const {
+    transform( lonlat, xy, n, stride, [this]( double crd[] ) { lonlat2xy( crd ); } );
 }
 
 template <>
@@ -40,6 +40,7 @@ void force_link() {
     static struct Link {
         Link() {
             TransBuilderGrid<TransLocal>();
+            TransBuilderFunctionSpace<TransLocal>();
 #if ATLAS_HAVE_TRANS
             TransBuilderGrid<TransIFS>();
             TransBuilderFunctionSpace<TransIFSStructuredColumns>();
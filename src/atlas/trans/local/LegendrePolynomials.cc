@@ -177,6 +177,10 @@ void compute_legendre_polynomials(
             //ATLAS_TRACE( "add to global arrays" );
 
             for ( size_t jm = 0; jm <= trc; jm++ ) {
+                if ( leg_start_sym[jm + 1] == leg_start_sym[jm] && leg_start_asym[jm + 1] == leg_start_asym[jm] ) {
+                    // no storage reserved for this zonal wave number
+                    continue;
+                }
                 size_t is1 = 0, ia1 = 0;
                 for ( size_t jn = jm; jn <= trc; jn++ ) {
                     ( jn - jm ) % 2 ? ia1++ : is1++;
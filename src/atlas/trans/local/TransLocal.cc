@@ -10,9 +10,11 @@
 
 #include "atlas/trans/local/TransLocal.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <fstream>
+#include <map>
 
 #include "eckit/config/YAMLConfiguration.h"
 #include "eckit/eckit.h"
@@ -25,17 +27,22 @@
 
 #include "atlas/array.h"
 #include "atlas/field.h"
+#include "atlas/functionspace/StructuredColumns.h"
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/option.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/trans/Trans.h"
 #include "atlas/trans/VorDivToUV.h"
 #include "atlas/trans/detail/TransFactory.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
 #include "atlas/util/Constants.h"
+#include "atlas/util/Earth.h"
+#include "atlas/util/GaussianLatitudes.h"
 
 #include "atlas/library/defines.h"
 #if ATLAS_HAVE_FFTW
@@ -53,6 +60,7 @@ namespace trans {
 
 namespace {
 static TransBuilderGrid<TransLocal> builder( "local", "local" );
+static TransBuilderFunctionSpace<TransLocal> builder_functionspace( "local(StructuredColumns,Spectral)", "local" );
 }  // namespace
 
 namespace {
@@ -252,10 +260,164 @@ struct FFTW_Data {
     fftw_complex* in;
     double* out;
     std::vector<fftw_plan> plans;
+    std::vector<fftw_plan> dirplans;  // only for global Gaussian grids
+
+    // Reduced grids: latitudes with equal number of longitudes are transformed together with one batched plan
+    struct LatitudeGroup {
+        int nlons;
+        std::vector<int> jlats;
+        fftw_plan plan;
+        fftw_plan dirplan;  // only for global Gaussian grids
+    };
+    std::vector<LatitudeGroup> groups;
 #endif
 };
+
+// Distribution of the work over the tasks, for a TransLocal constructed from a distributed StructuredColumns:
+//   - Legendre transform: zonal wavenumbers are distributed in a zig-zag fashion over the tasks, which balances
+//     the work as the number of total wavenumbers decreases with the zonal wavenumber.
+//   - Fourier transform: each latitude is transformed by the first task which owns grid points on it.
+//   - Grid points: as in the StructuredColumns function space, which owns a contiguous range of points per latitude.
+struct TransLocalPartition {
+    TransLocalPartition( const functionspace::StructuredColumns& fs, const int truncation ) {
+        ATLAS_TRACE( "TransLocalPartition" );
+        const auto& comm = mpi::comm();
+        nb_tasks         = static_cast<int>( comm.size() );
+        mytask           = static_cast<int>( comm.rank() );
+        const StructuredGrid grid( fs.grid() );
+        const idx_t ny = grid.ny();
+
+        zonal_wavenumber_task.resize( truncation + 1 );
+        zonal_wavenumbers.resize( nb_tasks );
+        for ( int jm = 0; jm <= truncation; ++jm ) {
+            const int cycle           = jm / nb_tasks;
+            const int pos             = jm % nb_tasks;
+            const int jtask           = ( cycle % 2 == 0 ) ? pos : nb_tasks - 1 - pos;
+            zonal_wavenumber_task[jm] = jtask;
+            zonal_wavenumbers[jtask].push_back( jm );
+        }
+
+        // Gather the grid point distribution of all tasks: j_begin, j_end, followed by i_begin, i_end for each row
+        std::vector<idx_t> send;
+        if ( fs.sizeOwned() > 0 ) {
+            send.push_back( fs.j_begin() );
+            send.push_back( fs.j_end() );
+            for ( idx_t j = fs.j_begin(); j < fs.j_end(); ++j ) {
+                send.push_back( fs.i_begin( j ) );
+                send.push_back( fs.i_end( j ) );
+            }
+        }
+        else {
+            send.push_back( 0 );
+            send.push_back( 0 );
+        }
+        eckit::mpi::Buffer<idx_t> recv( nb_tasks );
+        ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( send.begin(), send.end(), recv ); }
+
+        j_begin.resize( nb_tasks );
+        j_end.resize( nb_tasks );
+        i_begin.resize( nb_tasks );
+        i_end.resize( nb_tasks );
+        latitude_task.assign( ny, -1 );
+        latitudes.resize( nb_tasks );
+        for ( int jtask = 0; jtask < nb_tasks; ++jtask ) {
+            auto it        = recv.begin() + recv.displs[jtask];
+            j_begin[jtask] = *( it++ );
+            j_end[jtask]   = *( it++ );
+            for ( idx_t j = j_begin[jtask]; j < j_end[jtask]; ++j ) {
+                i_begin[jtask].push_back( *( it++ ) );
+                i_end[jtask].push_back( *( it++ ) );
+                if ( latitude_task[j] < 0 && i_end[jtask].back() > i_begin[jtask].back() ) {
+                    latitude_task[j] = jtask;
+                }
+            }
+        }
+        fourier_row_offset.assign( ny, 0 );
+        nb_fourier_points = 0;
+        for ( idx_t j = 0; j < ny; ++j ) {
+            ATLAS_ASSERT( latitude_task[j] >= 0 );
+            latitudes[latitude_task[j]].push_back( j );
+            if ( latitude_task[j] == mytask ) {
+                fourier_row_offset[j] = nb_fourier_points;
+                nb_fourier_points += grid.nx( j );
+            }
+        }
+
+        // offsets of the rows of this task in the (compact) owned grid points
+        owned_row_offset.assign( ny, 0 );
+        idx_t offset = 0;
+        for ( idx_t j = j_begin[mytask]; j < j_end[mytask]; ++j ) {
+            owned_row_offset[j] = offset;
+            offset += nx_owned( mytask, j );
+        }
+        ATLAS_ASSERT( offset == fs.sizeOwned() );
+        size_owned = offset;
+    }
+
+    // number of grid points of given task on latitude j
+    idx_t nx_owned( const int jtask, const idx_t j ) const {
+        if ( j < j_begin[jtask] || j >= j_end[jtask] ) {
+            return 0;
+        }
+        return i_end[jtask][j - j_begin[jtask]] - i_begin[jtask][j - j_begin[jtask]];
+    }
+
+    bool fourier_latitude( const idx_t j ) const { return latitude_task[j] == mytask; }
+
+    int nb_tasks;
+    int mytask;
+    idx_t size_owned;
+    idx_t nb_fourier_points;  // number of grid points on the latitudes of the Fourier transform of this task
+    std::vector<int> zonal_wavenumber_task;          // task of each zonal wavenumber
+    std::vector<std::vector<int>> zonal_wavenumbers;  // zonal wavenumbers of each task
+    std::vector<int> latitude_task;                  // task computing the Fourier transform of each latitude
+    std::vector<std::vector<int>> latitudes;         // latitudes of the Fourier transform of each task
+    std::vector<idx_t> j_begin;                      // first latitude with grid points of each task
+    std::vector<idx_t> j_end;                        // last latitude with grid points of each task, plus one
+    std::vector<std::vector<idx_t>> i_begin;         // per task, first grid point for each latitude
+    std::vector<std::vector<idx_t>> i_end;           // per task, last grid point for each latitude, plus one
+    std::vector<idx_t> owned_row_offset;             // offset of each latitude in the grid points of this task
+    std::vector<idx_t> fourier_row_offset;           // offset of each latitude in the Fourier transform of this task
+};
 }  // namespace detail
 
+namespace {
+
+// Calls f( jfld, imag, jlat, jm ) for each Fourier coefficient exchanged between two tasks in the transposition
+// between zonal wavenumbers and latitudes, in the order in which the coefficients are packed.
+template <typename Functor>
+void for_each_fourier_coefficient( const std::vector<int>& jlats, const std::vector<int>& jms, const int nb_fields,
+                                   const Functor& f ) {
+    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+        for ( int jlat : jlats ) {
+            for ( int jm : jms ) {
+                for ( int imag = 0; imag < 2; imag++ ) {
+                    f( jfld, imag, jlat, jm );
+                }
+            }
+        }
+    }
+}
+
+// Calls f( jfld, jlat, jlon ) for each grid point exchanged between the task computing the Fourier transform of
+// the latitudes and the task owning the grid points, in the order in which the grid points are packed.
+template <typename Functor>
+void for_each_gridpoint( const detail::TransLocalPartition& p, const int fourier_task, const int gridpoint_task,
+                         const int nb_fields, const Functor& f ) {
+    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+        for ( int jlat : p.latitudes[fourier_task] ) {
+            if ( jlat >= p.j_begin[gridpoint_task] && jlat < p.j_end[gridpoint_task] ) {
+                const idx_t jrow = jlat - p.j_begin[gridpoint_task];
+                for ( idx_t jlon = p.i_begin[gridpoint_task][jrow]; jlon < p.i_end[gridpoint_task][jrow]; jlon++ ) {
+                    f( jfld, jlat, jlon );
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // Class TransLocal
@@ -276,7 +438,7 @@ bool TransLocal::warning( const eckit::Configuration& config ) const {
 }
 
 TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& domain, const long truncation,
-                        const eckit::Configuration& config ) :
+                        const functionspace::StructuredColumns& gp, const eckit::Configuration& config ) :
     grid_( grid, domain ),
     truncation_( static_cast<int>( truncation ) ),
     precompute_( config.getBool( "precompute", true ) ),
@@ -286,9 +448,37 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
     fft_cache_( cache.fft().data() ),
     fft_cachesize_( cache.fft().size() ),
     fftw_( new detail::FFTW_Data ),
+    partition_( gp ? new detail::TransLocalPartition( gp, static_cast<int>( truncation ) ) : nullptr ),
     linalg_( linear_algebra_backend() ),
     warning_( TransParameters( config ).warning() ) {
     ATLAS_TRACE( "TransLocal constructor" );
+    if ( partition_ ) {
+        bool supported = StructuredGrid( grid_ ) && not grid_.projection() && grid_.domain().global();
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        supported = supported && TransParameters( config ).fft() == static_cast<int>( option::FFT::FFTW );
+#else
+        supported = false;
+#endif
+        if ( not supported ) {
+            std::ostringstream log;
+            log << "TransLocal with a StructuredColumns function space is only supported for global structured "
+                   "grids without projection, and requires FFTW."
+                << std::endl;
+            log << "    Grid: " << grid_.spec() << std::endl;
+            throw_NotImplemented( log.str(), Here() );
+        }
+        if ( legendre_cache_ || TransParameters( config ).export_legendre() ||
+             TransParameters( config ).write_legendre().size() ) {
+            throw_NotImplemented( "Legendre caches are not supported for TransLocal with a StructuredColumns function "
+                                  "space, as the Legendre polynomials are distributed",
+                                  Here() );
+        }
+    }
+    for ( int jm = 0; jm <= truncation_; ++jm ) {
+        if ( not partition_ || partition_->zonal_wavenumber_task[jm] == partition_->mytask ) {
+            zonal_wavenumbers_.push_back( jm );
+        }
+    }
     double fft_threshold = 0.0;  // fraction of latitudes of the full grid down to which FFT is used.
     // This threshold needs to be adjusted depending on the dgemm and FFT performance of the machine
     // on which this code is running!
@@ -442,7 +632,7 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
             }
             else {
                 // need to use FFT with cropped grid
-                if ( RegularGrid( gridGlobal_ ) ) {
+                if ( RegularGrid( gridGlobal_ ) && not partition_ ) {
                     for ( idx_t jlon = 0; jlon < nlonsMaxGlobal_; ++jlon ) {
                         if ( gs_global.x( jlon, 0 ) < lonmin ) {
                             jlonMin_[0]++;
@@ -501,6 +691,15 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
         }
         Log::info() << std::endl;*/
 
+        // quadrature weights for direct transforms:
+        if ( GaussianGrid( grid_ ) ) {
+            GaussianGrid gg( grid_ );
+            std::vector<double> gaussian_lats( 2 * gg.N() );
+            std::vector<double> gaussian_weights( 2 * gg.N() );
+            util::gaussian_quadrature_npole_spole( gg.N(), gaussian_lats.data(), gaussian_weights.data() );
+            gaussian_weights_.assign( gaussian_weights.begin(), gaussian_weights.begin() + gg.N() );
+        }
+
         // precomputations for Legendre polynomials:
         {
             const auto nlatsLeg = size_t( nlatsLeg_ );
@@ -511,8 +710,13 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
             legendre_sym_begin_[0]  = 0;
             legendre_asym_begin_[0] = 0;
             for ( idx_t jm = 0; jm <= truncation_ + 1; jm++ ) {
-                size_sym += add_padding( num_n( truncation_ + 1, jm, /*symmetric*/ true ) * nlatsLeg );
-                size_asym += add_padding( num_n( truncation_ + 1, jm, /*symmetric*/ false ) * nlatsLeg );
+                // only the zonal wavenumbers of this task are stored (the last one is never used)
+                const bool local = not partition_ || ( jm <= truncation_ && partition_->zonal_wavenumber_task[jm] ==
+                                                                                partition_->mytask );
+                if ( local ) {
+                    size_sym += add_padding( num_n( truncation_ + 1, jm, /*symmetric*/ true ) * nlatsLeg );
+                    size_asym += add_padding( num_n( truncation_ + 1, jm, /*symmetric*/ false ) * nlatsLeg );
+                }
                 legendre_sym_begin_[jm + 1]  = size_sym;
                 legendre_asym_begin_[jm + 1] = size_asym;
             }
@@ -586,18 +790,42 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
                 //                }
                 //                read.close();
                 //                if ( wisdomString.length() > 0 ) { fftw_import_wisdom_from_string( &wisdomString[0u] ); }
-                if ( RegularGrid( gridGlobal_ ) ) {
+                if ( RegularGrid( gridGlobal_ ) && not partition_ ) {
                     fftw_->plans.resize( 1 );
                     fftw_->plans[0] =
                         fftw_plan_many_dft_c2r( 1, &nlonsMaxGlobal_, nlats, fftw_->in, nullptr, 1, num_complex,
                                                 fftw_->out, nullptr, 1, nlonsMaxGlobal_, FFTW_ESTIMATE );
+                    if ( not gaussian_weights_.empty() ) {
+                        fftw_->dirplans.resize( 1 );
+                        fftw_->dirplans[0] =
+                            fftw_plan_many_dft_r2c( 1, &nlonsMaxGlobal_, nlats, fftw_->out, nullptr, 1, nlonsMaxGlobal_,
+                                                    fftw_->in, nullptr, 1, num_complex, FFTW_ESTIMATE );
+                    }
                 }
                 else {
-                    fftw_->plans.resize( nlatsLegDomain_ );
-                    for ( int j = 0; j < nlatsLegDomain_; j++ ) {
-                        int nlonsGlobalj = gs_global.nx( jlatMinLeg_ + j );
-                        //ASSERT( nlonsGlobalj > 0 && nlonsGlobalj <= nlonsMaxGlobal_ );
-                        fftw_->plans[j] = fftw_plan_dft_c2r_1d( nlonsGlobalj, fftw_->in, fftw_->out, FFTW_ESTIMATE );
+                    std::map<int, std::vector<int>> latitudes_per_nlons;
+                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                        if ( not partition_ || partition_->fourier_latitude( jlat ) ) {
+                            latitudes_per_nlons[nlonsGlobal_[jlat]].push_back( jlat );
+                        }
+                    }
+                    fftw_->groups.reserve( latitudes_per_nlons.size() );
+                    for ( auto& entry : latitudes_per_nlons ) {
+                        detail::FFTW_Data::LatitudeGroup group;
+                        group.nlons            = entry.first;
+                        group.jlats            = std::move( entry.second );
+                        const int howmany      = static_cast<int>( group.jlats.size() );
+                        const int num_complexj = ( group.nlons / 2 ) + 1;
+                        group.plan = fftw_plan_many_dft_c2r( 1, &group.nlons, howmany, fftw_->in, nullptr, 1,
+                                                             num_complexj, fftw_->out, nullptr, 1, group.nlons,
+                                                             FFTW_ESTIMATE );
+                        group.dirplan = nullptr;
+                        if ( not gaussian_weights_.empty() ) {
+                            group.dirplan = fftw_plan_many_dft_r2c( 1, &group.nlons, howmany, fftw_->out, nullptr, 1,
+                                                                    group.nlons, fftw_->in, nullptr, 1, num_complexj,
+                                                                    FFTW_ESTIMATE );
+                        }
+                        fftw_->groups.push_back( std::move( group ) );
                     }
                 }
                 std::string file_path = TransParameters( config ).write_fft();
@@ -706,6 +934,10 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
 
 // --------------------------------------------------------------------------------------------------------------------
 
+TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& domain, const long truncation,
+                        const eckit::Configuration& config ) :
+    TransLocal( cache, grid, domain, truncation, functionspace::StructuredColumns(), config ) {}
+
 TransLocal::TransLocal( const Grid& grid, const long truncation, const eckit::Configuration& config ) :
     TransLocal( Cache(), grid, grid.domain(), truncation, config ) {}
 
@@ -717,6 +949,16 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const long truncat
                         const eckit::Configuration& config ) :
     TransLocal( cache, grid, grid.domain(), truncation, config ) {}
 
+TransLocal::TransLocal( const functionspace::StructuredColumns& gp, const functionspace::Spectral& sp,
+                        const eckit::Configuration& config ) :
+    TransLocal( Cache(), gp, sp, config ) {}
+
+TransLocal::TransLocal( const Cache& cache, const functionspace::StructuredColumns& gp,
+                        const functionspace::Spectral& sp, const eckit::Configuration& config ) :
+    TransLocal( cache, gp.grid(), gp.grid().domain(), sp.truncation(), gp, config ) {
+    spectral_ = sp;
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 
 TransLocal::~TransLocal() {
@@ -730,6 +972,15 @@ TransLocal::~TransLocal() {
             for ( idx_t j = 0, size = static_cast<idx_t>( fftw_->plans.size() ); j < size; j++ ) {
                 fftw_destroy_plan( fftw_->plans[j] );
             }
+            for ( idx_t j = 0, size = static_cast<idx_t>( fftw_->dirplans.size() ); j < size; j++ ) {
+                fftw_destroy_plan( fftw_->dirplans[j] );
+            }
+            for ( auto& group : fftw_->groups ) {
+                fftw_destroy_plan( group.plan );
+                if ( group.dirplan ) {
+                    fftw_destroy_plan( group.dirplan );
+                }
+            }
             fftw_free( fftw_->in );
             fftw_free( fftw_->out );
 #endif
@@ -747,6 +998,12 @@ TransLocal::~TransLocal() {
 
 // --------------------------------------------------------------------------------------------------------------------
 
+idx_t TransLocal::nb_gridpoints() const {
+    return partition_ ? partition_->size_owned : grid_.size();
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 const functionspace::Spectral& TransLocal::spectral() const {
     if ( not spectral_ ) {
         spectral_ = functionspace::Spectral( Trans( this ) );
@@ -762,11 +1019,11 @@ void TransLocal::invtrans( const Field& spfield, Field& gpfield, const eckit::Co
     const auto scalar_spectra = array::make_view<double, 1>( spfield );
     auto gp_fields            = array::make_view<double, 1>( gpfield );
 
-    if ( gp_fields.shape( 0 ) < grid().size() ) {
+    if ( gp_fields.shape( 0 ) < nb_gridpoints() ) {
         // Hopefully the halo (if present) is appended
         ATLAS_DEBUG_VAR( gp_fields.shape( 0 ) );
-        ATLAS_DEBUG_VAR( grid().size() );
-        ATLAS_ASSERT( gp_fields.shape( 0 ) < grid().size() );
+        ATLAS_DEBUG_VAR( nb_gridpoints() );
+        ATLAS_ASSERT( gp_fields.shape( 0 ) < nb_gridpoints() );
     }
 
     invtrans( nb_scalar_fields, scalar_spectra.data(), gp_fields.data(), config );
@@ -815,14 +1072,19 @@ void TransLocal::invtrans_vordiv2wind( const Field& spvor, const Field& spdiv, F
     const auto divergence_spectra = array::make_view<double, 1>( spdiv );
     auto gp_fields                = array::make_view<double, 2>( gpwind );
 
-    if ( gp_fields.shape( 1 ) == grid().size() && gp_fields.shape( 0 ) == 2 ) {
+    const idx_t nb_gp = nb_gridpoints();
+    if ( gp_fields.shape( 1 ) == nb_gp && gp_fields.shape( 0 ) == 2 ) {
         invtrans( nb_vordiv_fields, vorticity_spectra.data(), divergence_spectra.data(), gp_fields.data(), config );
     }
-    else if ( gp_fields.shape( 0 ) == grid().size() && gp_fields.shape( 1 ) == 2 ) {
-        array::ArrayT<double> gpwind_t( gp_fields.shape( 1 ), gp_fields.shape( 0 ) );
+    else if ( gp_fields.shape( 0 ) >= nb_gp && gp_fields.shape( 1 ) == 2 ) {
+        // Any halo points are appended to the grid points of this task and left untouched
+        array::ArrayT<double> gpwind_t( 2, nb_gp );
         auto gp_fields_t = array::make_view<double, 2>( gpwind_t );
         invtrans( nb_vordiv_fields, vorticity_spectra.data(), divergence_spectra.data(), gp_fields_t.data(), config );
-        gp_transpose( grid().size(), 2, gp_fields_t.data(), gp_fields.data() );
+        for ( idx_t jgp = 0; jgp < nb_gp; ++jgp ) {
+            gp_fields( jgp, 0 ) = gp_fields_t( 0, jgp );
+            gp_fields( jgp, 1 ) = gp_fields_t( 1, jgp );
+        }
     }
     else {
         ATLAS_NOTIMPLEMENTED;
@@ -847,7 +1109,7 @@ void TransLocal::invtrans_legendre( const int truncation, const int nlats, const
         Log::debug() << "Legendre dgemm: using " << nlatsLegReduced_ - nlat0_[0] << " latitudes out of "
                      << nlatsGlobal_ / 2 << std::endl;
         ATLAS_TRACE( "Inverse Legendre Transform (GEMM)" );
-        for ( int jm = 0; jm <= truncation_; jm++ ) {
+        for ( int jm : zonal_wavenumbers_ ) {
             size_t size_sym  = num_n( truncation_ + 1, jm, true );
             size_t size_asym = num_n( truncation_ + 1, jm, false );
             const int n_imag = ( jm ? 2 : 1 );
@@ -1089,48 +1351,66 @@ void TransLocal::invtrans_fourier_reduced( const int nlats, const StructuredGrid
     if ( useFFT_ ) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
         {
-            {
-                ATLAS_TRACE( "Inverse Fourier Transform (FFTW, ReducedGrid)" );
-                int jgp = 0;
-                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
-                        int idx = 0;
-                        //Log::info() << jlat << "in:" << std::endl;
-                        int num_complex     = ( nlonsGlobal_[jlat] / 2 ) + 1;
-                        fftw_->in[idx++][0] = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
-                        //Log::info() << fftw_->in[0][0] << " ";
-                        for ( int jm = 1; jm < num_complex; jm++, idx++ ) {
+            ATLAS_TRACE( "Inverse Fourier Transform (FFTW, ReducedGrid)" );
+            // Each task transforms one group of latitudes with equal number of longitudes for one field,
+            // using buffers private to the thread (the plans themselves are shared, which FFTW allows).
+            const auto& groups  = fftw_->groups;
+            const int nb_groups = static_cast<int>( groups.size() );
+            const int nb_tasks  = nb_fields * nb_groups;
+            size_t size_in = 0, size_out = 0;
+            for ( const auto& group : groups ) {
+                size_in  = std::max( size_in, group.jlats.size() * ( group.nlons / 2 + 1 ) );
+                size_out = std::max( size_out, group.jlats.size() * group.nlons );
+            }
+            std::vector<idx_t> jgp_begin( nlats + 1 );
+            jgp_begin[0] = 0;
+            for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                // only latitudes transformed on this task are stored for distributed grid point fields
+                const bool local    = not partition_ || partition_->fourier_latitude( jlat );
+                jgp_begin[jlat + 1] = jgp_begin[jlat] + ( local ? g.nx( jlat ) : 0 );
+            }
+            const idx_t nb_gp = jgp_begin[nlats];
+
+            atlas_omp_parallel {
+                fftw_complex* in = fftw_alloc_complex( size_in );
+                double* out      = fftw_alloc_real( size_out );
+                atlas_omp_for( int jtask = 0; jtask < nb_tasks; jtask++ ) {
+                    const int jfld    = jtask / nb_groups;
+                    const auto& group = groups[jtask % nb_groups];
+                    int num_complex   = ( group.nlons / 2 ) + 1;
+                    for ( size_t jb = 0; jb < group.jlats.size(); jb++ ) {
+                        const int jlat        = group.jlats[jb];
+                        fftw_complex* in_jlat = in + jb * num_complex;
+                        in_jlat[0][0]         = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
+                        in_jlat[0][1]         = 0.;
+                        for ( int jm = 1; jm < num_complex; jm++ ) {
                             for ( int imag = 0; imag < 2; imag++ ) {
                                 if ( jm <= truncation_ ) {
-                                    fftw_->in[idx][imag] =
+                                    in_jlat[jm][imag] =
                                         scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
                                 }
                                 else {
-                                    fftw_->in[idx][imag] = 0.;
+                                    in_jlat[jm][imag] = 0.;
                                 }
-                                //Log::info() << fftw_->in[idx][imag] << " ";
                             }
                         }
-                        //Log::info() << std::endl;
-                        //Log::info() << jlat << "out:" << std::endl;
-                        int jplan = nlatsLegDomain_ - nlatsNH_ + jlat;
-                        if ( jplan >= nlatsLegDomain_ ) {
-                            jplan = nlats - 1 + nlatsLegDomain_ - nlatsSH_ - jlat;
-                        };
-                        //ASSERT( jplan < nlatsLeg_ && jplan >= 0 );
-                        fftw_execute_dft_c2r( fftw_->plans[jplan], fftw_->in, fftw_->out );
+                    }
+                    fftw_execute_dft_c2r( group.plan, in, out );
+                    for ( size_t jb = 0; jb < group.jlats.size(); jb++ ) {
+                        const int jlat         = group.jlats[jb];
+                        const double* out_jlat = out + jb * group.nlons;
+                        idx_t jgp              = jgp_begin[jlat] + jfld * nb_gp;
                         for ( int jlon = 0; jlon < g.nx( jlat ); jlon++ ) {
                             int j = jlon + jlonMin_[jlat];
                             if ( j >= nlonsGlobal_[jlat] ) {
                                 j -= nlonsGlobal_[jlat];
                             }
-                            //Log::info() << fftw_->out[j] << " ";
-                            ATLAS_ASSERT( j < nlonsMaxGlobal_ );
-                            gp_fields[jgp++] = fftw_->out[j];
+                            gp_fields[jgp++] = out_jlat[j];
                         }
-                        //Log::info() << std::endl;
                     }
                 }
+                fftw_free( in );
+                fftw_free( out );
             }
         }
 #endif
@@ -1142,6 +1422,71 @@ void TransLocal::invtrans_fourier_reduced( const int nlats, const StructuredGrid
     }
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+// Transposition of the Fourier coefficients of the zonal wavenumbers of this task (for all latitudes) to the
+// Fourier coefficients of the latitudes of this task (for all zonal wavenumbers).
+//
+void TransLocal::invtrans_transpose_fourier( const int nlats, const int nb_fields, double scl_fourier[] ) const {
+    ATLAS_TRACE( "Inverse transposition (zonal wavenumbers to latitudes)" );
+    const auto& p = *partition_;
+    std::vector<std::vector<double>> send( p.nb_tasks );
+    std::vector<std::vector<double>> recv( p.nb_tasks );
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        auto& buffer = send[jtask];
+        buffer.reserve( 2 * nb_fields * p.latitudes[jtask].size() * p.zonal_wavenumbers[p.mytask].size() );
+        for_each_fourier_coefficient( p.latitudes[jtask], p.zonal_wavenumbers[p.mytask], nb_fields,
+                                      [&]( int jfld, int imag, int jlat, int jm ) {
+                                          buffer.push_back(
+                                              scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] );
+                                      } );
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( send, recv ); }
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        const auto& buffer = recv[jtask];
+        size_t k           = 0;
+        for_each_fourier_coefficient( p.latitudes[p.mytask], p.zonal_wavenumbers[jtask], nb_fields,
+                                      [&]( int jfld, int imag, int jlat, int jm ) {
+                                          scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                              buffer[k++];
+                                      } );
+        ATLAS_ASSERT( k == buffer.size() );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Transposition of the grid point values on the latitudes of this task (as computed by the Fourier transform)
+// to the grid points owned by this task.
+//
+void TransLocal::invtrans_transpose_gridpoints( const int nb_fields, const double gp_rows[],
+                                                double gp_fields[] ) const {
+    ATLAS_TRACE( "Inverse transposition (latitudes to grid points)" );
+    const auto& p = *partition_;
+    auto row      = [&]( int jfld, idx_t jlat, idx_t jlon ) {
+        return p.fourier_row_offset[jlat] + jfld * p.nb_fourier_points + jlon;
+    };
+    auto owned = [&]( int jfld, idx_t jlat, idx_t jlon ) {
+        return p.owned_row_offset[jlat] + jfld * p.size_owned + jlon -
+               p.i_begin[p.mytask][jlat - p.j_begin[p.mytask]];
+    };
+    std::vector<std::vector<double>> send( p.nb_tasks );
+    std::vector<std::vector<double>> recv( p.nb_tasks );
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        auto& buffer = send[jtask];
+        for_each_gridpoint( p, p.mytask, jtask, nb_fields, [&]( int jfld, idx_t jlat, idx_t jlon ) {
+            buffer.push_back( gp_rows[row( jfld, jlat, jlon )] );
+        } );
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( send, recv ); }
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        const auto& buffer = recv[jtask];
+        size_t k           = 0;
+        for_each_gridpoint( p, jtask, p.mytask, nb_fields, [&]( int jfld, idx_t jlat, idx_t jlon ) {
+            gp_fields[owned( jfld, jlat, jlon )] = buffer[k++];
+        } );
+        ATLAS_ASSERT( k == buffer.size() );
+    }
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_unstructured_precomp( const int truncation, const int nb_fields, const int nb_vordiv_fields,
@@ -1374,7 +1719,13 @@ void TransLocal::invtrans_uv( const int truncation, const int nb_scalar_fields,
                                config );
 
             // Fourier transformation:
-            if ( RegularGrid( gridGlobal_ ) ) {
+            if ( partition_ ) {
+                std::vector<double> gp_rows( nb_fields * partition_->nb_fourier_points );
+                invtrans_transpose_fourier( nlats, nb_fields, scl_fourier );
+                invtrans_fourier_reduced( nlats, g, nb_fields, scl_fourier, gp_rows.data(), config );
+                invtrans_transpose_gridpoints( nb_fields, gp_rows.data(), gp_fields );
+            }
+            else if ( RegularGrid( gridGlobal_ ) ) {
                 invtrans_fourier_regular( nlats, nlons, nb_fields, scl_fourier, gp_fields, config );
             }
             else {
@@ -1401,7 +1752,9 @@ void TransLocal::invtrans_uv( const int truncation, const int nb_scalar_fields,
                     int idx = 0;
                     for ( idx_t jfld = 0; jfld < 2 * nb_vordiv_fields && jfld < nb_fields; jfld++ ) {
                         for ( idx_t jlat = 0; jlat < g.ny(); jlat++ ) {
-                            for ( idx_t jlon = 0; jlon < g.nx( jlat ); jlon++ ) {
+                            const idx_t nx =
+                                partition_ ? partition_->nx_owned( partition_->mytask, jlat ) : g.nx( jlat );
+                            for ( idx_t jlon = 0; jlon < nx; jlon++ ) {
                                 gp_fields[idx] *= coslatinvs[jlat];
                                 idx++;
                             }
@@ -1458,7 +1811,7 @@ void extend_truncation( const int old_truncation, const int nb_fields, const dou
 void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spectra[], const int nb_vordiv_fields,
                            const double vorticity_spectra[], const double divergence_spectra[], double gp_fields[],
                            const eckit::Configuration& config ) const {
-    int nb_gp = grid_.size();
+    int nb_gp = nb_gridpoints();
     if ( nb_vordiv_fields > 0 ) {
         // collect all spectral data into one array "all_spectra":
         ATLAS_TRACE( "TransLocal::invtrans" );
@@ -1535,44 +1888,493 @@ void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spect
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans( const Field& gpfield, Field& spfield, const eckit::Configuration& config ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
+    int nb_scalar_fields = 1;
+    const auto gp_fields = array::make_view<double, 1>( gpfield );
+    auto scalar_spectra  = array::make_view<double, 1>( spfield );
+
+    ATLAS_ASSERT( gp_fields.shape( 0 ) >= nb_gridpoints() );
+
+    dirtrans( nb_scalar_fields, gp_fields.data(), scalar_spectra.data(), config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans( const FieldSet& gpfields, FieldSet& spfields, const eckit::Configuration& config ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
+    ATLAS_ASSERT( gpfields.size() == spfields.size() );
+    for ( idx_t f = 0; f < gpfields.size(); ++f ) {
+        dirtrans( gpfields[f], spfields[f], config );
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans_wind2vordiv( const Field& gpwind, Field& spvor, Field& spdiv,
                                        const eckit::Configuration& config ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
+    int nb_vordiv_fields    = 1;
+    const auto gp_fields    = array::make_view<double, 2>( gpwind );
+    auto vorticity_spectra  = array::make_view<double, 1>( spvor );
+    auto divergence_spectra = array::make_view<double, 1>( spdiv );
+
+    const idx_t nb_gp = nb_gridpoints();
+    if ( gp_fields.shape( 1 ) == nb_gp && gp_fields.shape( 0 ) == 2 ) {
+        dirtrans( nb_vordiv_fields, gp_fields.data(), vorticity_spectra.data(), divergence_spectra.data(), config );
+    }
+    else if ( gp_fields.shape( 0 ) >= nb_gp && gp_fields.shape( 1 ) == 2 ) {
+        array::ArrayT<double> gpwind_t( 2, nb_gp );
+        auto gp_fields_t = array::make_view<double, 2>( gpwind_t );
+        gp_transpose( nb_gp, 2, gp_fields.data(), gp_fields_t.data() );
+        dirtrans( nb_vordiv_fields, gp_fields_t.data(), vorticity_spectra.data(), divergence_spectra.data(), config );
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields,
+                                           const double gp_fields[], double scl_fourier[],
+                                           const eckit::Configuration& ) const {
+    // Fourier transformation:
+    if ( useFFT_ ) {
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        {
+            ATLAS_ASSERT( nlons == nlonsMaxGlobal_ );
+            int num_complex    = ( nlonsMaxGlobal_ / 2 ) + 1;
+            const double scale = 1. / nlonsMaxGlobal_;
+            {
+                ATLAS_TRACE( "Direct Fourier Transform (FFTW, RegularGrid)" );
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                        for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                            fftw_->out[jlon + nlonsMaxGlobal_ * jlat] =
+                                gp_fields[jlon + nlons * ( jlat + nlats * jfld )];
+                        }
+                    }
+                    fftw_execute_dft_r2c( fftw_->dirplans[0], fftw_->out, fftw_->in );
+                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                        int idx = num_complex * jlat;
+                        for ( int jm = 0; jm <= truncation_; jm++ ) {
+                            for ( int imag = 0; imag < 2; imag++ ) {
+                                scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                    ( jm < num_complex ) ? fftw_->in[idx + jm][imag] * scale : 0.;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    }
+    else {
+#if !TRANSLOCAL_DGEMM2
+        // dgemm-method 1, with the transposed (and rescaled) matrix of the inverse transform
+        {
+            ATLAS_TRACE( "Direct Fourier Transform (NoFFT)" );
+            const int nb_coeffs = ( truncation_ + 1 ) * 2;
+            double* fouriertp;
+            alloc_aligned( fouriertp, nb_coeffs * nlons );
+            for ( int jm = 0; jm < truncation_ + 1; jm++ ) {
+                double factor = ( jm > 0 ? 2. : 1. ) * nlons;
+                for ( int imag = 0; imag < 2; imag++ ) {
+                    for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                        fouriertp[imag + 2 * jm + nb_coeffs * jlon] =
+                            fourier_[jlon + nlons * ( imag + 2 * jm )] / factor;
+                    }
+                }
+            }
+            eckit::linalg::Matrix A( fouriertp, nb_coeffs, nlons );
+            eckit::linalg::Matrix B( const_cast<double*>( gp_fields ), nlons, nb_fields * nlats );
+            eckit::linalg::Matrix C( scl_fourier, nb_coeffs, nb_fields * nlats );
+            linalg_.gemm( A, B, C );
+            free_aligned( fouriertp );
+        }
+#else
+        ATLAS_NOTIMPLEMENTED;
+#endif
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_reduced( const int nlats, const StructuredGrid& g, const int nb_fields,
+                                           const double gp_fields[], double scl_fourier[],
+                                           const eckit::Configuration& ) const {
+    // Fourier transformation:
+    if ( useFFT_ ) {
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        {
+            ATLAS_TRACE( "Direct Fourier Transform (FFTW, ReducedGrid)" );
+            // Same task decomposition as in invtrans_fourier_reduced
+            const auto& groups  = fftw_->groups;
+            const int nb_groups = static_cast<int>( groups.size() );
+            const int nb_tasks  = nb_fields * nb_groups;
+            size_t size_in = 0, size_out = 0;
+            for ( const auto& group : groups ) {
+                size_in  = std::max( size_in, group.jlats.size() * ( group.nlons / 2 + 1 ) );
+                size_out = std::max( size_out, group.jlats.size() * group.nlons );
+            }
+            std::vector<idx_t> jgp_begin( nlats + 1 );
+            jgp_begin[0] = 0;
+            for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                ATLAS_ASSERT( g.nx( jlat ) == nlonsGlobal_[jlat] );
+                const bool local    = not partition_ || partition_->fourier_latitude( jlat );
+                jgp_begin[jlat + 1] = jgp_begin[jlat] + ( local ? g.nx( jlat ) : 0 );
+            }
+            const idx_t nb_gp = jgp_begin[nlats];
+
+            atlas_omp_parallel {
+                fftw_complex* in = fftw_alloc_complex( size_in );
+                double* out      = fftw_alloc_real( size_out );
+                atlas_omp_for( int jtask = 0; jtask < nb_tasks; jtask++ ) {
+                    const int jfld    = jtask / nb_groups;
+                    const auto& group = groups[jtask % nb_groups];
+                    int num_complex   = ( group.nlons / 2 ) + 1;
+                    for ( size_t jb = 0; jb < group.jlats.size(); jb++ ) {
+                        const int jlat   = group.jlats[jb];
+                        double* out_jlat = out + jb * group.nlons;
+                        idx_t jgp        = jgp_begin[jlat] + jfld * nb_gp;
+                        for ( int jlon = 0; jlon < group.nlons; jlon++ ) {
+                            out_jlat[jlon] = gp_fields[jgp++];
+                        }
+                    }
+                    fftw_execute_dft_r2c( group.dirplan, out, in );
+                    const double scale = 1. / group.nlons;
+                    for ( size_t jb = 0; jb < group.jlats.size(); jb++ ) {
+                        const int jlat              = group.jlats[jb];
+                        const fftw_complex* in_jlat = in + jb * num_complex;
+                        for ( int jm = 0; jm <= truncation_; jm++ ) {
+                            for ( int imag = 0; imag < 2; imag++ ) {
+                                scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                    ( jm < num_complex ) ? in_jlat[jm][imag] * scale : 0.;
+                            }
+                        }
+                    }
+                }
+                fftw_free( in );
+                fftw_free( out );
+            }
+        }
+#endif
+    }
+    else {
+        throw_NotImplemented(
+            "Using dgemm in Fourier transform for reduced grids is extremely slow. Please install and use FFTW!",
+            Here() );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Transposition of the grid points owned by this task to the latitudes of the Fourier transform of this task,
+// the reverse of invtrans_transpose_gridpoints.
+//
+void TransLocal::dirtrans_transpose_gridpoints( const int nb_fields, const double gp_fields[],
+                                                double gp_rows[] ) const {
+    ATLAS_TRACE( "Direct transposition (grid points to latitudes)" );
+    const auto& p = *partition_;
+    auto row      = [&]( int jfld, idx_t jlat, idx_t jlon ) {
+        return p.fourier_row_offset[jlat] + jfld * p.nb_fourier_points + jlon;
+    };
+    auto owned = [&]( int jfld, idx_t jlat, idx_t jlon ) {
+        return p.owned_row_offset[jlat] + jfld * p.size_owned + jlon -
+               p.i_begin[p.mytask][jlat - p.j_begin[p.mytask]];
+    };
+    std::vector<std::vector<double>> send( p.nb_tasks );
+    std::vector<std::vector<double>> recv( p.nb_tasks );
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        auto& buffer = send[jtask];
+        for_each_gridpoint( p, jtask, p.mytask, nb_fields, [&]( int jfld, idx_t jlat, idx_t jlon ) {
+            buffer.push_back( gp_fields[owned( jfld, jlat, jlon )] );
+        } );
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( send, recv ); }
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        const auto& buffer = recv[jtask];
+        size_t k           = 0;
+        for_each_gridpoint( p, p.mytask, jtask, nb_fields, [&]( int jfld, idx_t jlat, idx_t jlon ) {
+            gp_rows[row( jfld, jlat, jlon )] = buffer[k++];
+        } );
+        ATLAS_ASSERT( k == buffer.size() );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Transposition of the Fourier coefficients of the latitudes of this task to the Fourier coefficients of the zonal
+// wavenumbers of this task, the reverse of invtrans_transpose_fourier.
+//
+void TransLocal::dirtrans_transpose_fourier( const int nlats, const int nb_fields, double scl_fourier[] ) const {
+    ATLAS_TRACE( "Direct transposition (latitudes to zonal wavenumbers)" );
+    const auto& p = *partition_;
+    std::vector<std::vector<double>> send( p.nb_tasks );
+    std::vector<std::vector<double>> recv( p.nb_tasks );
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        auto& buffer = send[jtask];
+        buffer.reserve( 2 * nb_fields * p.latitudes[p.mytask].size() * p.zonal_wavenumbers[jtask].size() );
+        for_each_fourier_coefficient( p.latitudes[p.mytask], p.zonal_wavenumbers[jtask], nb_fields,
+                                      [&]( int jfld, int imag, int jlat, int jm ) {
+                                          buffer.push_back(
+                                              scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] );
+                                      } );
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( send, recv ); }
+    for ( int jtask = 0; jtask < p.nb_tasks; jtask++ ) {
+        const auto& buffer = recv[jtask];
+        size_t k           = 0;
+        for_each_fourier_coefficient( p.latitudes[jtask], p.zonal_wavenumbers[p.mytask], nb_fields,
+                                      [&]( int jfld, int imag, int jlat, int jm ) {
+                                          scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                              buffer[k++];
+                                      } );
+        ATLAS_ASSERT( k == buffer.size() );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_legendre( const int truncation, const int nlats, const int nb_fields,
+                                    const double scl_fourier[], double scalar_spectra[],
+                                    const eckit::Configuration& ) const {
+    // Legendre transform (Gaussian quadrature), using the same precomputed polynomials as the inverse transform:
+    {
+        ATLAS_TRACE( "Direct Legendre Transform (GEMM)" );
+        for ( size_t j = 0; j < 2 * legendre_size( truncation ) * nb_fields; ++j ) {
+            scalar_spectra[j] = 0.;
+        }
+        for ( int jm : zonal_wavenumbers_ ) {
+            if ( jm > truncation ) {
+                break;
+            }
+            size_t size_sym  = num_n( truncation_ + 1, jm, true );
+            size_t size_asym = num_n( truncation_ + 1, jm, false );
+            const int n_imag = ( jm ? 2 : 1 );
+            const int nlatsC = nlatsLegReduced_ - nlat0_[jm];
+            if ( nlatsC <= 0 ) {
+                continue;
+            }
+            auto posFourier = [&]( int jfld, int imag, int jlat ) {
+                return nlatsC - nlatsNH_ + jlat + nlatsC * ( jfld + nb_fields * imag );
+            };
+            double* scl_fourier_sym;
+            double* scl_fourier_asym;
+            double* scalar_sym;
+            double* scalar_asym;
+            alloc_aligned( scl_fourier_sym, nb_fields * n_imag * nlatsC );
+            alloc_aligned( scl_fourier_asym, nb_fields * n_imag * nlatsC );
+            alloc_aligned( scalar_sym, n_imag * nb_fields * size_sym );
+            alloc_aligned( scalar_asym, n_imag * nb_fields * size_asym );
+            {
+                //ATLAS_TRACE( "split spheres" );
+                // latitudes are paired with their mirror latitude on the southern hemisphere
+                for ( int jlat = 0; jlat < nlatsNH_; jlat++ ) {
+                    if ( nlatsC - nlatsNH_ + jlat >= 0 ) {
+                        const int jslat = nlats - jlat - 1;
+                        const double w  = gaussian_weights_[jlat];
+                        for ( int imag = 0; imag < n_imag; imag++ ) {
+                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                const double north = scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
+                                const double south = scl_fourier[posMethod( jfld, imag, jslat, jm, nb_fields, nlats )];
+                                int idx            = posFourier( jfld, imag, jlat );
+                                scl_fourier_sym[idx]  = w * ( north + south );
+                                scl_fourier_asym[idx] = w * ( north - south );
+                            }
+                        }
+                    }
+                }
+            }
+            {
+                eckit::linalg::Matrix A( legendre_sym_ + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym, size_sym,
+                                         nlatsC );
+                eckit::linalg::Matrix B( scl_fourier_sym, nlatsC, nb_fields * n_imag );
+                eckit::linalg::Matrix C( scalar_sym, size_sym, nb_fields * n_imag );
+                linalg_.gemm( A, B, C );
+            }
+            if ( size_asym > 0 ) {
+                eckit::linalg::Matrix A( legendre_asym_ + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym, size_asym,
+                                         nlatsC );
+                eckit::linalg::Matrix B( scl_fourier_asym, nlatsC, nb_fields * n_imag );
+                eckit::linalg::Matrix C( scalar_asym, size_asym, nb_fields * n_imag );
+                linalg_.gemm( A, B, C );
+            }
+            {
+                //ATLAS_TRACE( "Legendre merge" );
+                // total wavenumbers are stored in descending order, see invtrans_legendre
+                idx_t is = 0, ia = 0, ioff = ( 2 * truncation + 3 - jm ) * jm / 2 * nb_fields * 2;
+                for ( int jn = truncation_ + 1; jn >= jm; jn-- ) {
+                    const bool sym    = ( ( jn - jm ) % 2 == 0 );
+                    const idx_t k     = ( sym ? is++ : ia++ );
+                    const double* res = ( sym ? scalar_sym + k : scalar_asym + k );
+                    const size_t size = ( sym ? size_sym : size_asym );
+                    if ( jn <= truncation ) {
+                        for ( int imag = 0; imag < n_imag; imag++ ) {
+                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                int idx = jfld + nb_fields * ( imag + 2 * ( jn - jm ) );
+                                scalar_spectra[idx + ioff] = res[size * ( jfld + nb_fields * imag )];
+                            }
+                        }
+                    }
+                }
+                ATLAS_ASSERT( size_t( is ) == size_sym && size_t( ia ) == size_asym );
+            }
+            free_aligned( scl_fourier_sym );
+            free_aligned( scl_fourier_asym );
+            free_aligned( scalar_sym );
+            free_aligned( scalar_asym );
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Routine to compute the direct spectral transform on a global Gaussian grid, the reverse of invtrans_uv.
+// The first 2*nb_vordiv_fields fields (u and v) are divided by cos(latitude) before the transform.
+//
+// The parameter truncation is the truncation used in storing the spectral data scalar_spectra, and can be at most
+// truncation_+1 (the truncation up to which the Legendre polynomials are precomputed).
+//
+void TransLocal::dirtrans_uv( const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
+                              const double gp_fields[], double scalar_spectra[],
+                              const eckit::Configuration& config ) const {
+    if ( gaussian_weights_.empty() ) {
+        std::ostringstream log;
+        log << "Direct transforms with TransLocal are only supported for global Gaussian grids without projection, "
+               "as they require Gaussian quadrature."
+            << std::endl;
+        log << "    Grid: " << grid_.spec() << std::endl;
+        throw_NotImplemented( log.str(), Here() );
+    }
+    ATLAS_ASSERT( truncation <= truncation_ + 1 );
+    if ( nb_scalar_fields > 0 ) {
+        int nb_fields = nb_scalar_fields;
+        auto g        = StructuredGrid( grid_ );
+        ATLAS_TRACE( "dirtrans_uv structured" );
+        int nlats = g.ny();
+        int nlons = g.nxmax();
+
+        // Computing u/cos(lat), v/cos(lat):
+        std::vector<double> gp_scaled;
+        if ( nb_vordiv_fields > 0 ) {
+            ATLAS_TRACE( "compute u/cos(lat),v/cos(lat)" );
+            std::vector<double> coslatinvs( nlats );
+            for ( idx_t j = 0; j < nlats; ++j ) {
+                coslatinvs[j] = 1. / std::cos( g.y( j ) * util::Constants::degreesToRadians() );
+            }
+            gp_scaled.assign( gp_fields, gp_fields + nb_fields * nb_gridpoints() );
+            int idx = 0;
+            for ( idx_t jfld = 0; jfld < 2 * nb_vordiv_fields && jfld < nb_fields; jfld++ ) {
+                for ( idx_t jlat = 0; jlat < g.ny(); jlat++ ) {
+                    const idx_t nx = partition_ ? partition_->nx_owned( partition_->mytask, jlat ) : g.nx( jlat );
+                    for ( idx_t jlon = 0; jlon < nx; jlon++ ) {
+                        gp_scaled[idx] *= coslatinvs[jlat];
+                        idx++;
+                    }
+                }
+            }
+            gp_fields = gp_scaled.data();
+        }
+
+        double* scl_fourier;
+        alloc_aligned( scl_fourier, nb_fields * 2 * nlats * ( truncation_ + 1 ) );
+
+        // Fourier transformation:
+        if ( partition_ ) {
+            std::vector<double> gp_rows( nb_fields * partition_->nb_fourier_points );
+            dirtrans_transpose_gridpoints( nb_fields, gp_fields, gp_rows.data() );
+            dirtrans_fourier_reduced( nlats, g, nb_fields, gp_rows.data(), scl_fourier, config );
+            dirtrans_transpose_fourier( nlats, nb_fields, scl_fourier );
+        }
+        else if ( RegularGrid( gridGlobal_ ) ) {
+            dirtrans_fourier_regular( nlats, nlons, nb_fields, gp_fields, scl_fourier, config );
+        }
+        else {
+            dirtrans_fourier_reduced( nlats, g, nb_fields, gp_fields, scl_fourier, config );
+        }
+
+        // Legendre transformation:
+        dirtrans_legendre( truncation, nlats, nb_fields, scl_fourier, scalar_spectra, config );
+
+        // Each task contributes the zonal wavenumbers of its Legendre transform:
+        if ( partition_ ) {
+            ATLAS_TRACE_MPI( ALLREDUCE ) {
+                mpi::comm().allReduceInPlace( scalar_spectra, 2 * legendre_size( truncation ) * nb_fields,
+                                              eckit::mpi::sum() );
+            }
+        }
+
+        free_aligned( scl_fourier );
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans( const int nb_fields, const double scalar_fields[], double scalar_spectra[],
-                           const eckit::Configuration& ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+                           const eckit::Configuration& config ) const {
+    dirtrans_uv( truncation_, nb_fields, 0, scalar_fields, scalar_spectra, config );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Routine to compute spectral vorticity and divergence out of the spectral coefficients (up to truncation+1) of
+// u/cos(latitude) and v/cos(latitude). This is the reverse of vd2uv, using
+//     (1-mu^2) dP_n^m/dmu = -n*eps_{n+1}^m P_{n+1}^m + (n+1)*eps_n^m P_{n-1}^m
+// Reference:
+//        Temperton, 1991, MWR 119 p1303
+//
+void uv2vd( const int truncation,          // truncation of vorticity and divergence
+            const int nb_vordiv_fields,    // number of vorticity and divergence fields
+            const double UV[],             // spectral data of u/cos(lat) and v/cos(lat), truncation+1
+            double vorticity_spectra[],    // spectral data of vorticity
+            double divergence_spectra[] )  // spectral data of divergence
+{
+    const int nb_fields = 2 * nb_vordiv_fields;
+    const double za_r   = 1. / util::Earth::radius();
+    auto epsilon        = []( const int n, const int m ) {
+        return std::sqrt( double( n * n - m * m ) / ( 4. * n * n - 1. ) );
+    };
+    auto posUV = [&]( int jfld, int imag, int jn, int jm ) {
+        return jfld + nb_fields * ( imag + 2 * ( ( 2 * truncation + 5 - jm ) * jm / 2 + jn - jm ) );
+    };
+    int k = 0;
+    for ( int jm = 0; jm <= truncation; jm++ ) {      // zonal wavenumber
+        for ( int jn = jm; jn <= truncation; jn++ ) {  // total wavenumber
+            const double epsP1 = epsilon( jn + 1, jm );                 // contribution of n+1
+            const double epsM1 = ( jn > jm ? epsilon( jn, jm ) : 0. );  // contribution of n-1
+            for ( int imag = 0; imag < 2; imag++ ) {                    // imaginary/real part
+                // multiplication with i*m:
+                const int iother   = 1 - imag;
+                const double imsgn = ( imag ? +1. : -1. ) * jm;
+                for ( int jfld = 0; jfld < nb_vordiv_fields; jfld++ ) {  // field
+                    const int ju = jfld, jv = jfld + nb_vordiv_fields;  // u and v fields
+                    double vor = imsgn * UV[posUV( jv, iother, jn, jm )] -
+                                 jn * epsP1 * UV[posUV( ju, imag, jn + 1, jm )];
+                    double div = imsgn * UV[posUV( ju, iother, jn, jm )] +
+                                 jn * epsP1 * UV[posUV( jv, imag, jn + 1, jm )];
+                    if ( jn > jm ) {
+                        vor += ( jn + 1 ) * epsM1 * UV[posUV( ju, imag, jn - 1, jm )];
+                        div -= ( jn + 1 ) * epsM1 * UV[posUV( jv, imag, jn - 1, jm )];
+                    }
+                    vorticity_spectra[k + jfld]  = vor * za_r;
+                    divergence_spectra[k + jfld] = div * za_r;
+                }
+                k += nb_vordiv_fields;
+            }
+        }
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
-void TransLocal::dirtrans( const int nb_fields, const double wind_fields[], double vorticity_spectra[],
-                           double divergence_spectra[], const eckit::Configuration& ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+void TransLocal::dirtrans( const int nb_vordiv_fields, const double wind_fields[], double vorticity_spectra[],
+                           double divergence_spectra[], const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "TransLocal::dirtrans" );
+    // compute u/cos(lat) and v/cos(lat) in spectral space with truncation increased by one:
+    int nb_fields = 2 * nb_vordiv_fields;
+    std::vector<double> UV_ext( 2 * legendre_size( truncation_ + 1 ) * nb_fields );
+    dirtrans_uv( truncation_ + 1, nb_fields, nb_vordiv_fields, wind_fields, UV_ext.data(), config );
+    {
+        ATLAS_TRACE( "UV to vordiv" );
+        uv2vd( truncation_, nb_vordiv_fields, UV_ext.data(), vorticity_spectra, divergence_spectra );
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -33,6 +33,9 @@ namespace atlas {
 class Field;
 class FieldSet;
 class StructuredGrid;
+namespace functionspace {
+class StructuredColumns;
+}  // namespace functionspace
 }  // namespace atlas
 
 //-----------------------------------------------------------------------------
@@ -42,7 +45,8 @@ namespace trans {
 
 namespace detail {
 struct FFTW_Data;
-}
+struct TransLocalPartition;
+}  // namespace detail
 
 class LegendreCacheCreatorLocal;
 int fourier_truncation( const int truncation,  // truncation
@@ -64,8 +68,13 @@ int fourier_truncation( const int truncation,  // truncation
 ///  - support multiple fields
 ///  - support atlas::Field and atlas::FieldSet based on function spaces
 ///
-/// @note: Direct transforms are not implemented and cannot be unless
-///        the grid is global. There are no plans to support this at the moment.
+/// @note: Direct transforms are only implemented for global Gaussian grids,
+///        as they require the Gaussian quadrature weights.
+///
+/// @note: When constructed from a (distributed) StructuredColumns function space, grid point fields only
+///        contain the points owned by this task. Zonal wavenumbers are then distributed over the tasks for the
+///        Legendre transform, and latitudes for the Fourier transform, so that each task only holds its share
+///        of the Legendre polynomials. Spectral fields are not distributed.
 class TransLocal : public trans::TransImpl {
 public:
     TransLocal( const Grid&, const long truncation, const eckit::Configuration& = util::NoConfig() );
@@ -73,6 +82,10 @@ public:
     TransLocal( const Cache&, const Grid&, const long truncation, const eckit::Configuration& = util::NoConfig() );
     TransLocal( const Cache&, const Grid&, const Domain&, const long truncation,
                 const eckit::Configuration& = util::NoConfig() );
+    TransLocal( const functionspace::StructuredColumns&, const functionspace::Spectral&,
+                const eckit::Configuration& = util::NoConfig() );
+    TransLocal( const Cache&, const functionspace::StructuredColumns&, const functionspace::Spectral&,
+                const eckit::Configuration& = util::NoConfig() );
 
     virtual ~TransLocal() override;
 
@@ -114,7 +127,7 @@ public:
                            const double divergence_spectra[], double gp_fields[],
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
-    // -- NOT SUPPORTED -- //
+    // -- Direct transforms (global Gaussian grids only) --
 
     virtual void dirtrans( const Field& gpfield, Field& spfield,
                            const eckit::Configuration& = util::NoConfig() ) const override;
@@ -132,6 +145,12 @@ public:
                            double divergence_spectra[], const eckit::Configuration& = util::NoConfig() ) const override;
 
 private:
+    TransLocal( const Cache&, const Grid&, const Domain&, const long truncation,
+                const functionspace::StructuredColumns&, const eckit::Configuration& );
+
+    /// Number of grid points of this task
+    idx_t nb_gridpoints() const;
+
     int posMethod( const int jfld, const int imag, const int jlat, const int jm, const int nb_fields,
                    const int nlats ) const {
 #if !TRANSLOCAL_DGEMM2
@@ -163,6 +182,30 @@ private:
                       const double scalar_spectra[], double gp_fields[],
                       const eckit::Configuration& = util::NoConfig() ) const;
 
+    void dirtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields, const double gp_fields[],
+                                   double scl_fourier[], const eckit::Configuration& config ) const;
+
+    void dirtrans_fourier_reduced( const int nlats, const StructuredGrid& g, const int nb_fields,
+                                   const double gp_fields[], double scl_fourier[],
+                                   const eckit::Configuration& config ) const;
+
+    void dirtrans_legendre( const int truncation, const int nlats, const int nb_fields, const double scl_fourier[],
+                            double scalar_spectra[], const eckit::Configuration& config ) const;
+
+    void dirtrans_uv( const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
+                      const double gp_fields[], double scalar_spectra[],
+                      const eckit::Configuration& = util::NoConfig() ) const;
+
+    // -- Transpositions for distributed grid point fields --
+
+    void invtrans_transpose_fourier( const int nlats, const int nb_fields, double scl_fourier[] ) const;
+
+    void invtrans_transpose_gridpoints( const int nb_fields, const double gp_rows[], double gp_fields[] ) const;
+
+    void dirtrans_transpose_gridpoints( const int nb_fields, const double gp_fields[], double gp_rows[] ) const;
+
+    void dirtrans_transpose_fourier( const int nlats, const int nb_fields, double scl_fourier[] ) const;
+
     bool warning( const eckit::Configuration& = util::NoConfig() ) const;
 
     friend class LegendreCacheCreatorLocal;
@@ -197,6 +240,8 @@ private:
     std::vector<size_t> legendre_begin_;
     std::vector<size_t> legendre_sym_begin_;
     std::vector<size_t> legendre_asym_begin_;
+    std::vector<double> gaussian_weights_;  // quadrature weights of northern hemisphere, empty if not Gaussian
+    std::vector<int> zonal_wavenumbers_;    // zonal wavenumbers of the Legendre transform on this task
 
     Cache cache_;
     Cache export_legendre_;
@@ -206,6 +251,7 @@ private:
     size_t fft_cachesize_{0};
 
     std::unique_ptr<detail::FFTW_Data> fftw_;
+    std::unique_ptr<detail::TransLocalPartition> partition_;  // only for distributed StructuredColumns
 
     const eckit::linalg::LinearAlgebra& linalg_;
     int warning_ = 0;
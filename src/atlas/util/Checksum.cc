@@ -10,6 +10,8 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <cstring>
+#include <type_traits>
 
 #include "atlas/util/Checksum.h"
 
@@ -29,6 +31,34 @@ static uint16_t fletcher16( const uint8_t* data, int size ) {
     return s2;
 }
 
+// Finaliser of the splitmix64 generator, giving a well mixed 64 bit hash of a 64 bit value
+inline uint64_t mix64( uint64_t x ) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+template <typename T>
+inline uint64_t bits( const T& value ) {
+    using UINT = typename std::conditional<sizeof( T ) == 8, uint64_t, uint32_t>::type;
+    static_assert( sizeof( UINT ) == sizeof( T ), "Only 4 or 8 byte types are supported" );
+    UINT b;
+    std::memcpy( &b, &value, sizeof( T ) );
+    return b;
+}
+
+template <typename T>
+checksum_t checksum_point( const T values[], size_t size, gidx_t global_index ) {
+    uint64_t h = 0;
+    for ( size_t k = 0; k < size; ++k ) {
+        h += mix64( bits( values[k] ) + ( k + 1 ) * 0x9e3779b97f4a7c15ULL );
+    }
+    return static_cast<checksum_t>( mix64( h ^ mix64( static_cast<uint64_t>( global_index ) ) ) );
+}
+
 }  // namespace
 
 static checksum_t checksum( const char* data, size_t size ) {
@@ -59,5 +89,21 @@ checksum_t checksum( const checksum_t values[], size_t size ) {
     return checksum( reinterpret_cast<const char*>( &values[0] ), size * sizeof( checksum_t ) / sizeof( char ) );
 }
 
+checksum_t checksum( const int values[], size_t size, gidx_t global_index ) {
+    return checksum_point( values, size, global_index );
+}
+
+checksum_t checksum( const long values[], size_t size, gidx_t global_index ) {
+    return checksum_point( values, size, global_index );
+}
+
+checksum_t checksum( const float values[], size_t size, gidx_t global_index ) {
+    return checksum_point( values, size, global_index );
+}
+
+checksum_t checksum( const double values[], size_t size, gidx_t global_index ) {
+    return checksum_point( values, size, global_index );
+}
+
 }  // namespace util
 }  // namespace atlas
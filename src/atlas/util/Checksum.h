@@ -12,6 +12,8 @@
 
 #include <cstddef>
 
+#include "atlas/library/config.h"
+
 namespace atlas {
 namespace util {
 
@@ -23,5 +25,15 @@ checksum_t checksum( const float values[], size_t size );
 checksum_t checksum( const double values[], size_t size );
 checksum_t checksum( const checksum_t values[], size_t size );
 
+/// @brief Checksum of the values of one point with given global index
+///
+/// Every value is hashed independently, so that the loop over the values vectorises. The sum (modulo 2^64) of
+/// the checksums of all points is independent of the order in which the points are visited, yet depends on the
+/// association of values with global indices.
+checksum_t checksum( const int values[], size_t size, gidx_t global_index );
+checksum_t checksum( const long values[], size_t size, gidx_t global_index );
+checksum_t checksum( const float values[], size_t size, gidx_t global_index );
+checksum_t checksum( const double values[], size_t size, gidx_t global_index );
+
 }  // namespace util
 }  // namespace atlas
@@ -164,6 +164,20 @@ public:
         return get()->closestPointsWithinRadius( p, radius );
     }
 
+    /// @brief Find k closest points of each of the given 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat)
+    /// The searches are sorted spatially and run in parallel threads. Results are in the order of the given points.
+    template <typename Point>
+    std::vector<ValueList> closestPoints( const std::vector<Point>& points, size_t k ) const {
+        return get()->closestPoints( points, k );
+    }
+
+    /// @brief Find closest point of each of the given 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat)
+    /// The searches are sorted spatially and run in parallel threads. Results are in the order of the given points.
+    template <typename Point>
+    std::vector<Value> closestPoint( const std::vector<Point>& points ) const {
+        return get()->closestPoint( points );
+    }
+
     /// @brief Return geometry used to convert (lon,lat) to (x,y,z) coordinates
     const Geometry& geometry() const { return get()->geometry(); }
 };
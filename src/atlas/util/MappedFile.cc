@@ -0,0 +1,100 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/MappedFile.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "eckit/io/DataHandle.h"
+
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+
+namespace atlas {
+namespace util {
+
+MappedFile::MappedFile( const eckit::PathName& path ) : path_( path ) {
+    if ( not path_.exists() ) {
+        throw_Exception( "File " + path_.asString() + " does not exist", Here() );
+    }
+    size_ = path_.size();
+    if ( size_ == 0 ) {
+        return;
+    }
+
+    int fd = ::open( path_.localPath(), O_RDONLY );
+    if ( fd < 0 ) {
+        throw_Exception( "Could not open file " + path_.asString() + ": " + std::strerror( errno ), Here() );
+    }
+    address_ = ::mmap( nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+    if ( address_ == MAP_FAILED ) {
+        address_ = nullptr;
+        throw_Exception( "Could not memory-map file " + path_.asString() + ": " + std::strerror( errno ), Here() );
+    }
+}
+
+MappedFile::~MappedFile() {
+    if ( address_ ) {
+        ::munmap( address_, size_ );
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+MappedFileWriter::MappedFileWriter( const eckit::PathName& path ) :
+    path_( path ), tmp_( path.asString() + ".tmp." + std::to_string( ::getpid() ) ), handle_( tmp_.fileHandle() ) {
+    handle_->openForWrite( 0 );
+}
+
+MappedFileWriter::~MappedFileWriter() {
+    if ( handle_ ) {
+        // Not closed, e.g. after an exception: the incomplete file is discarded
+        try {
+            handle_->close();
+        }
+        catch ( const std::exception& e ) {
+            Log::error() << "Could not close file " << tmp_ << ": " << e.what() << std::endl;
+        }
+        std::remove( tmp_.localPath() );
+    }
+}
+
+void MappedFileWriter::write( const void* data, size_t bytes ) {
+    ATLAS_ASSERT( handle_ );
+    static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    if ( bytes ) {
+        handle_->write( data, bytes );
+    }
+    if ( align( bytes ) != bytes ) {
+        handle_->write( padding, align( bytes ) - bytes );
+    }
+}
+
+void MappedFileWriter::close() {
+    ATLAS_ASSERT( handle_ );
+    handle_->close();
+    handle_.reset();
+    if ( std::rename( tmp_.localPath(), path_.localPath() ) != 0 ) {
+        const std::string error = std::strerror( errno );
+        std::remove( tmp_.localPath() );
+        throw_Exception( "Could not write file " + path_.asString() + ": " + error, Here() );
+    }
+}
+
+}  // namespace util
+}  // namespace atlas
@@ -0,0 +1,80 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "eckit/filesystem/PathName.h"
+
+namespace eckit {
+class DataHandle;
+}
+
+namespace atlas {
+namespace util {
+
+/// @brief Read access to a complete file through a private memory mapping
+///
+/// Pages are only read from disk when first accessed, and are shared with the page cache as long as they are
+/// not written to. Writing to the mapping is allowed, but never changes the file.
+class MappedFile {
+public:
+    MappedFile( const eckit::PathName& );
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+    ~MappedFile();
+
+    const eckit::PathName& path() const { return path_; }
+    size_t size() const { return size_; }
+
+    const char* data() const { return static_cast<const char*>( address_ ); }
+    char* data() { return static_cast<char*>( address_ ); }
+
+private:
+    eckit::PathName path_;
+    void* address_{nullptr};
+    size_t size_{0};
+};
+
+/// @brief Round up to a multiple of 8 bytes, the alignment of all sections in memory-mapped atlas files
+inline size_t align( size_t bytes ) {
+    constexpr size_t alignment = 8;
+    return ( ( bytes + alignment - 1 ) / alignment ) * alignment;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// @brief Writer of a file to be memory-mapped, in which every section starts at a multiple of 8 bytes
+///
+/// The file is written under a temporary name and renamed by close(), so that it appears atomically and a
+/// concurrent reader never maps an incomplete file. Without close(), e.g. after an exception, nothing appears.
+class MappedFileWriter {
+public:
+    MappedFileWriter( const eckit::PathName& );
+    MappedFileWriter( const MappedFileWriter& ) = delete;
+    MappedFileWriter& operator=( const MappedFileWriter& ) = delete;
+    ~MappedFileWriter();
+
+    /// @brief Write a section, padded to a multiple of 8 bytes
+    void write( const void* data, size_t bytes );
+
+    /// @brief Complete the file and move it to its path
+    void close();
+
+private:
+    eckit::PathName path_;
+    eckit::PathName tmp_;
+    std::unique_ptr<eckit::DataHandle> handle_;
+};
+
+}  // namespace util
+}  // namespace atlas
@@ -10,12 +10,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
 #include <iosfwd>
+#include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "eckit/container/KDTree.h"
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Geometry.h"
@@ -52,6 +61,8 @@ public:
         using Point   = typename KDTreeTraits::Point;
         using Payload = typename KDTreeTraits::Payload;
 
+        Value() = default;
+
         template <typename Node>
         Value( const Node& node ) : Value( node.point(), node.payload(), node.distance() ) {}
 
@@ -73,6 +84,7 @@ public:
     class ValueList : public std::vector<Value> {
     public:
         using std::vector<Value>::vector;
+        ValueList() = default;
         PayloadList payloads() const {
             PayloadList list;
             list.reserve( this->size() );
@@ -209,7 +221,96 @@ public:
         return do_closestPointsWithinRadius( p, radius );
     }
 
+    /// @brief Find k nearest neighbours of each of the given 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat)
+    /// @return One ValueList per point, in the order of the given points
+    /// @note The searches are distributed over OpenMP threads in the order of a space-filling curve through the
+    ///       points, so that consecutive searches of a thread visit mostly the same nodes of the tree.
+    template <typename QueryPoint>
+    std::vector<ValueList> closestPoints( const std::vector<QueryPoint>& points, size_t k ) const {
+        return batch<ValueList>( points, [&]( const Point& p ) { return do_closestPoints( p, k ); } );
+    }
+
+    /// @brief Find nearest neighbour of each of the given 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat)
+    /// @return One Value per point, in the order of the given points
+    /// @note See closestPoints(points,k) for the parallelisation
+    template <typename QueryPoint>
+    std::vector<Value> closestPoint( const std::vector<QueryPoint>& points ) const {
+        return batch<Value>( points, [&]( const Point& p ) { return do_closestPoint( p ); } );
+    }
+
 private:
+    template <typename Result, typename QueryPoint, typename Search>
+    std::vector<Result> batch( const std::vector<QueryPoint>& query_points, const Search& search ) const {
+        const size_t size = query_points.size();
+        std::vector<Point> points( size );
+        atlas_omp_parallel_for( size_t j = 0; j < size; ++j ) { points[j] = to_Point( query_points[j] ); }
+
+        const std::vector<size_t> order = spatial_order( points );
+
+        std::vector<Result> results( size );
+        std::exception_ptr exception;
+        atlas_omp_parallel_for( size_t j = 0; j < size; ++j ) {
+            try {
+                results[order[j]] = search( points[order[j]] );
+            }
+            catch ( ... ) {
+                atlas_omp_critical { exception = std::current_exception(); }
+            }
+        }
+        if ( exception ) {
+            std::rethrow_exception( exception );
+        }
+        return results;
+    }
+
+    /// @brief Order of the points along a Z-order (Morton) curve through their bounding box
+    static std::vector<size_t> spatial_order( const std::vector<Point>& points ) {
+        constexpr size_t dims = Point::DIMS;
+        constexpr size_t bits = 63 / dims;  // bits per dimension in the 64-bit key
+        const size_t size     = points.size();
+
+        std::array<double, dims> min;
+        std::array<double, dims> scale;
+        for ( size_t d = 0; d < dims; ++d ) {
+            double max = -std::numeric_limits<double>::max();
+            min[d]     = std::numeric_limits<double>::max();
+            for ( const auto& p : points ) {
+                min[d] = std::min( min[d], p[d] );
+                max    = std::max( max, p[d] );
+            }
+            scale[d] = max > min[d] ? double( ( uint64_t( 1 ) << bits ) - 1 ) / ( max - min[d] ) : 0.;
+        }
+
+        std::vector<std::pair<uint64_t, size_t>> keys( size );
+        atlas_omp_parallel_for( size_t j = 0; j < size; ++j ) {
+            std::array<uint64_t, dims> q;
+            for ( size_t d = 0; d < dims; ++d ) {
+                q[d] = static_cast<uint64_t>( ( points[j][d] - min[d] ) * scale[d] );
+            }
+            uint64_t key = 0;
+            for ( size_t b = bits; b-- > 0; ) {
+                for ( size_t d = 0; d < dims; ++d ) {
+                    key = ( key << 1 ) | ( ( q[d] >> b ) & 1 );
+                }
+            }
+            keys[j] = std::make_pair( key, j );
+        }
+        omp::sort( keys.begin(), keys.end() );
+
+        std::vector<size_t> order( size );
+        for ( size_t j = 0; j < size; ++j ) {
+            order[j] = keys[j].second;
+        }
+        return order;
+    }
+
+    const Point& to_Point( const Point& p ) const { return p; }
+
+    template <typename LonLat, ENABLE_IF_3D_AND_IS_LONLAT( LonLat )>
+    Point to_Point( const LonLat& p ) const {
+        return make_Point( p );
+    }
+
     /// @brief Insert spherical point (lon,lat)
     /// If memory has been reserved with reserve(), insertion will be delayed until build() is called.
     void do_insert( const Point& p, const Payload& payload ) { insert( Value{p, payload} ); }
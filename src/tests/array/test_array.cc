@@ -17,6 +17,8 @@
 
 #if ATLAS_HAVE_GRIDTOOLS_STORAGE
 #include "atlas/array/gridtools/GridToolsMakeView.h"
+#else
+#include "atlas/array/native/NativeDataStore.h"
 #endif
 
 using namespace atlas::array;
@@ -596,6 +598,54 @@ CASE( "test_aligned_Array" ) {
     }
 }
 
+#if !ATLAS_HAVE_GRIDTOOLS_STORAGE
+CASE( "test_memory_pool" ) {
+    EXPECT_EQ( native::MemoryPool::size_class( 1 ), 256 );
+    EXPECT_EQ( native::MemoryPool::size_class( 1000 ), 1024 );
+    EXPECT_EQ( native::MemoryPool::size_class( 1025 ), 1280 );
+    EXPECT_EQ( native::MemoryPool::size_class( 2048 ), 2048 );
+
+    auto& pool         = native::MemoryPool::instance();
+    auto& watermark    = native::MemoryHighWatermark::instance();
+    const bool enabled = pool.enabled();
+    pool.enable( true );
+
+    void* storage = nullptr;
+    {
+        ArrayT<double> array( 1000 );
+        storage = array.storage();
+    }
+    const size_t hits = watermark.pool_hits_;
+    {
+        // Same size class: the block is recycled
+        ArrayT<double> array( 990 );
+        EXPECT( array.storage() == storage );
+        EXPECT_EQ( size_t( watermark.pool_hits_ ), hits + 1 );
+        EXPECT_EQ( reinterpret_cast<size_t>( array.storage() ) % ( 64 * sizeof( double ) ), 0 );
+
+        // Disabling the pool releases the cached blocks, and blocks still in use are freed instead of cached
+        pool.enable( false );
+        EXPECT_EQ( size_t( watermark.pooled_ ), 0 );
+    }
+    EXPECT_EQ( size_t( watermark.pooled_ ), 0 );
+
+    // Blocks beyond the cap on cached bytes are freed instead of cached
+    pool.enable( true );
+    const size_t max_cached = pool.max_cached();
+    pool.max_cached( native::MemoryPool::size_class( 1000 * sizeof( double ) ) );
+    {
+        ArrayT<double> array1( 1000 );
+        ArrayT<double> array2( 1000 );
+    }
+    EXPECT_EQ( size_t( watermark.pooled_ ), native::MemoryPool::size_class( 1000 * sizeof( double ) ) );
+    pool.max_cached( 0 );
+    EXPECT_EQ( size_t( watermark.pooled_ ), 0 );
+    pool.max_cached( max_cached );
+
+    pool.enable( enabled );
+}
+#endif
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
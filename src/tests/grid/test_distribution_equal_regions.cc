@@ -0,0 +1,73 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <string>
+#include <vector>
+
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Log.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using Grid = atlas::Grid;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_equal_regions_functional" ) {
+    for ( std::string gridname : {"O32", "N24", "L64x33"} ) {
+        for ( idx_t nb_partitions : {1, 2, 7, 16, 37} ) {
+            Log::info() << gridname << " with " << nb_partitions << " partitions" << std::endl;
+            Grid grid( gridname );
+            grid::Partitioner partitioner( "equal_regions", nb_partitions );
+
+            grid::Distribution functional( grid, partitioner );
+            EXPECT_EQ( functional.nb_partitions(), nb_partitions );
+            EXPECT( functional.footprint() < grid.size() * sizeof( int ) / 4 );
+
+            // Reference: the same points as unstructured grid, which are sorted explicitly by the partitioner
+            std::vector<PointXY> points;
+            points.reserve( grid.size() );
+            for ( const auto& p : grid.xy() ) {
+                points.emplace_back( p );
+            }
+            grid::Distribution reference( UnstructuredGrid( points ), partitioner );
+
+            EXPECT( functional.nb_pts() == reference.nb_pts() );
+            idx_t nb_mismatch = 0;
+            for ( gidx_t n = 0; n < grid.size(); ++n ) {
+                if ( functional.partition( n ) != reference.partition( n ) ) {
+                    ++nb_mismatch;
+                }
+            }
+            EXPECT_EQ( nb_mismatch, 0 );
+        }
+    }
+}
+
+CASE( "test_equal_regions_structuredcolumns" ) {
+    Grid grid( "O32" );
+    grid::Distribution distribution( grid, grid::Partitioner( "equal_regions" ) );
+    functionspace::StructuredColumns fs( grid, distribution );
+    EXPECT_EQ( fs.sizeOwned(), distribution.nb_pts()[mpi::rank()] );
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
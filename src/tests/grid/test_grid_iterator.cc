@@ -15,6 +15,7 @@
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/grid/UnstructuredGrid.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Config.h"
 
@@ -90,6 +91,66 @@ CASE( "test_iterator" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "test_fill" ) {
+    std::vector<Grid> grids;
+
+    grids.emplace_back( "L4x3" );
+    grids.emplace_back( "O32" );
+    grids.emplace_back( "O16", Projection( "rotated_schmidt",
+                                           Config( "stretching_factor", 2.4 ) | Config( "north_pole", {2.0, 46.7} ) ) );
+    grids.emplace_back( UnstructuredGrid( std::vector<PointXY>{{0, 90}, {90, 45}, {180, 0}, {270, -45}, {0, -90}} ) );
+
+    for ( auto grid : grids ) {
+        Log::debug() << "grid : " << grid.name() << std::endl;
+
+        std::vector<PointXY> points_xy;
+        std::vector<PointLonLat> points_lonlat;
+        for ( const PointXY& xy : grid.xy() ) {
+            points_xy.push_back( xy );
+        }
+        for ( const PointLonLat& ll : grid.lonlat() ) {
+            points_lonlat.push_back( ll );
+        }
+
+        const gidx_t size = grid.size();
+        std::vector<std::pair<gidx_t, gidx_t>> ranges{
+            {0, size}, {0, 0}, {size, size}, {1, size - 1}, {size / 3, size / 2}, {size - 1, size}};
+
+        for ( const auto& range : ranges ) {
+            const gidx_t begin = range.first;
+            const gidx_t end   = range.second;
+
+            std::vector<PointXY> xy( end - begin );
+            grid.xy().fill( begin, end, xy.data() );
+            for ( gidx_t n = begin; n < end; ++n ) {
+                EXPECT( xy[n - begin] == points_xy[n] );
+            }
+
+            std::vector<double> lonlat( 2 * ( end - begin ) );
+            grid.lonlat().fill( begin, end, lonlat.data() );
+            for ( gidx_t n = begin; n < end; ++n ) {
+                EXPECT_APPROX_EQ( lonlat[2 * ( n - begin ) + 0], points_lonlat[n].lon(), 1.e-12 );
+                EXPECT_APPROX_EQ( lonlat[2 * ( n - begin ) + 1], points_lonlat[n].lat(), 1.e-12 );
+            }
+        }
+
+        // Blocks filled concurrently
+        std::vector<PointXY> xy( size );
+        const gidx_t block_size = 7;
+        const gidx_t nb_blocks  = ( size + block_size - 1 ) / block_size;
+        atlas_omp_parallel_for( gidx_t block = 0; block < nb_blocks; ++block ) {
+            const gidx_t begin = block * block_size;
+            const gidx_t end   = std::min( begin + block_size, size );
+            grid.xy().fill( begin, end, xy.data() + begin );
+        }
+        EXPECT( xy == points_xy );
+
+        EXPECT_THROWS_AS( grid.xy().fill( 0, size + 1, xy.data() ), eckit::AssertionFailed );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
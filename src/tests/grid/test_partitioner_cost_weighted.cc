@@ -0,0 +1,120 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/grid/detail/partitioner/CostWeightedPartitioner.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using Grid   = atlas::Grid;
+using Config = atlas::util::Config;
+using atlas::grid::detail::partitioner::CostWeightedPartitioner;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+// Synthetic cost, ten times more expensive in the northern hemisphere
+std::vector<double> synthetic_cost( const Grid& grid ) {
+    std::vector<double> cost;
+    cost.reserve( grid.size() );
+    for ( const auto& p : grid.xy() ) {
+        cost.emplace_back( p.y() > 0. ? 10. : 1. );
+    }
+    return cost;
+}
+
+std::vector<double> partition_cost( const grid::Distribution& distribution, const std::vector<double>& cost ) {
+    std::vector<double> partition_cost( distribution.nb_partitions(), 0. );
+    for ( gidx_t n = 0; n < gidx_t( cost.size() ); ++n ) {
+        partition_cost[distribution.partition( n )] += cost[n];
+    }
+    return partition_cost;
+}
+
+double imbalance( const std::vector<double>& partition_cost ) {
+    double max  = *std::max_element( partition_cost.begin(), partition_cost.end() );
+    double mean = 0.;
+    for ( double c : partition_cost ) {
+        mean += c;
+    }
+    mean /= partition_cost.size();
+    return max / mean - 1.;
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_cost_weighted_weights" ) {
+    Grid grid( "O32" );
+    auto cost = synthetic_cost( grid );
+    for ( std::string layout : {"equal_regions", "bands"} ) {
+        grid::Partitioner partitioner( "cost_weighted", Config( "partitions", 8 ) | Config( "layout", layout ) |
+                                                            Config( "weights", cost ) );
+        grid::Distribution distribution( grid, partitioner );
+        EXPECT_EQ( distribution.nb_partitions(), 8 );
+        double imb = imbalance( partition_cost( distribution, cost ) );
+        Log::info() << layout << " imbalance: " << imb << std::endl;
+        EXPECT( imb < 0.02 );
+
+        // The equal_regions partitioner balances points, not cost
+        grid::Distribution unweighted( grid, grid::Partitioner( "equal_regions", 8 ) );
+        EXPECT( imbalance( partition_cost( unweighted, cost ) ) > 0.2 );
+    }
+}
+
+CASE( "test_cost_weighted_function" ) {
+    Grid grid( "O32" );
+    auto cost = synthetic_cost( grid );
+    grid::Partitioner partitioner( new CostWeightedPartitioner( 8, [&]( gidx_t n ) { return cost[n]; } ) );
+    grid::Distribution distribution( grid, partitioner );
+    EXPECT( imbalance( partition_cost( distribution, cost ) ) < 0.02 );
+}
+
+CASE( "test_cost_weighted_repartition" ) {
+    Grid grid( "O32" );
+    auto cost = synthetic_cost( grid );
+
+    // Measured costs of each partition, as would be obtained from timings
+    grid::Distribution distribution( grid, grid::Partitioner( "equal_regions", 8 ) );
+    EXPECT( imbalance( partition_cost( distribution, cost ) ) > 0.2 );
+    for ( int iteration = 0; iteration < 3; ++iteration ) {
+        grid::Partitioner partitioner(
+            new CostWeightedPartitioner( distribution, partition_cost( distribution, cost ) ) );
+        distribution = grid::Distribution( grid, partitioner );
+        double imb   = imbalance( partition_cost( distribution, cost ) );
+        Log::info() << "iteration " << iteration << " imbalance: " << imb << std::endl;
+        EXPECT( imb < 0.1 );
+    }
+}
+
+CASE( "test_cost_weighted_gather_partition_cost" ) {
+    auto partition_cost = CostWeightedPartitioner::gather_partition_cost( double( mpi::rank() ) );
+    EXPECT_EQ( partition_cost.size(), mpi::size() );
+    for ( idx_t p = 0; p < idx_t( partition_cost.size() ); ++p ) {
+        EXPECT_EQ( partition_cost[p], double( p ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
@@ -0,0 +1,93 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using Grid   = atlas::Grid;
+using Config = atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_hilbert_partitioner" ) {
+    std::vector<PointXY> points;
+    for ( const auto& p : Grid( "O16" ).xy() ) {
+        points.emplace_back( p );
+    }
+
+    for ( auto grid : {Grid( "O32" ), Grid( UnstructuredGrid( points ) )} ) {
+        for ( idx_t nb_partitions : {idx_t( mpi::size() ), idx_t( 7 )} ) {
+            Log::info() << grid.name() << " with " << nb_partitions << " partitions" << std::endl;
+            grid::Distribution distribution( grid, grid::Partitioner( "hilbert", nb_partitions ) );
+            EXPECT_EQ( distribution.nb_partitions(), nb_partitions );
+
+            const auto& nb_pts = distribution.nb_pts();
+            EXPECT( *std::max_element( nb_pts.begin(), nb_pts.end() ) -
+                        *std::min_element( nb_pts.begin(), nb_pts.end() ) <=
+                    1 );
+
+            // Pieces of the curve are compact: with 4 or more partitions each one covers at most two of the
+            // quadrants visited by the first level of the curve
+            for ( idx_t p = 0; nb_partitions >= 4 && p < nb_partitions; ++p ) {
+                double xmin = 360.;
+                double xmax = -360.;
+                double ymin = 90.;
+                double ymax = -90.;
+                gidx_t n    = 0;
+                for ( const auto& point : grid.xy() ) {
+                    if ( distribution.partition( n++ ) == p ) {
+                        xmin = std::min( xmin, point.x() );
+                        xmax = std::max( xmax, point.x() );
+                        ymin = std::min( ymin, point.y() );
+                        ymax = std::max( ymax, point.y() );
+                    }
+                }
+                EXPECT( ( xmax - xmin ) * ( ymax - ymin ) <= 0.5 * 360. * 180. );
+            }
+        }
+    }
+}
+
+CASE( "test_hilbert_partitioner_weights" ) {
+    Grid grid( "O32" );
+    std::vector<double> weights;
+    for ( const auto& p : grid.xy() ) {
+        weights.emplace_back( p.y() > 0. ? 10. : 1. );
+    }
+    grid::Distribution distribution(
+        grid, grid::Partitioner( "hilbert", Config( "partitions", 8 ) | Config( "weights", weights ) ) );
+    std::vector<double> cost( 8, 0. );
+    for ( gidx_t n = 0; n < grid.size(); ++n ) {
+        cost[distribution.partition( n )] += weights[n];
+    }
+    double max = *std::max_element( cost.begin(), cost.end() );
+    double min = *std::min_element( cost.begin(), cost.end() );
+    EXPECT( ( max - min ) / max < 0.02 );
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
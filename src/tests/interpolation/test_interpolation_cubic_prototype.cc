@@ -333,6 +333,21 @@ CASE( "test 3d cubic interpolation" ) {
             Log::info() << p << "  -->  " << interpolated << "      [exact] " << exact << std::endl;
             EXPECT( is_approximately_equal( interpolated, exact, tolerance ) );
         }
+
+        // Cached stencils and weights give identical results, when filling the cache and when using it
+        Interpolation cached( option::type( "tricubic" ) | matrix_free | Config( "cache_weights", true ), fs,
+                              departure_points );
+        Field cached_output = Field( "cached", make_datatype<double>(), make_shape( departure_points.size() ) );
+        auto cached_view    = array::make_view<double, 1>( cached_output );
+        for ( int execution = 0; execution < 2; ++execution ) {
+            cached_view.assign( 0. );
+            cached.execute( input, cached_output );
+            idx_t wrong = 0;
+            for ( idx_t n = 0; n < cached_view.shape( 0 ); ++n ) {
+                wrong += cached_view( n ) != output_view( n );
+            }
+            EXPECT( wrong == 0 );
+        }
     }
 
     SECTION( "SL-like" ) {
@@ -382,6 +397,23 @@ CASE( "test 3d cubic interpolation" ) {
                 }
             }
         }
+
+        // Cached stencils and weights give identical results, when filling the cache and when using it
+        Interpolation cached( option::type( "tricubic" ) | matrix_free | Config( "cache_weights", true ), fs,
+                              dp_field );
+        Field cached_output = fs.createField<double>();
+        auto cached_view    = array::make_view<double, 2>( cached_output );
+        for ( int execution = 0; execution < 2; ++execution ) {
+            cached_view.assign( 0. );
+            cached.execute( input, cached_output );
+            idx_t wrong = 0;
+            for ( idx_t n = 0; n < cached_view.shape( 0 ); ++n ) {
+                for ( idx_t k = 0; k < cached_view.shape( 1 ); ++k ) {
+                    wrong += cached_view( n, k ) != output_view( n, k );
+                }
+            }
+            EXPECT( wrong == 0 );
+        }
     }
 }
 
@@ -9,7 +9,10 @@
  */
 
 #include <cmath>
+#include <fstream>
+#include <vector>
 
+#include "eckit/filesystem/PathName.h"
 #include "eckit/types/FloatCompare.h"
 
 #include "atlas/array.h"
@@ -17,6 +20,7 @@
 #include "atlas/functionspace/PointCloud.h"
 #include "atlas/grid.h"
 #include "atlas/interpolation.h"
+#include "atlas/interpolation/Cache.h"
 #include "atlas/mesh.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -79,6 +83,172 @@ CASE( "test_interpolation_finite_element" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "test_interpolation_finite_element_fieldset" ) {
+    Grid grid( "O32" );
+    MeshGenerator meshgen( "structured" );
+    Mesh mesh = meshgen.generate( grid );
+    NodeColumns fs( mesh );
+
+    PointCloud pointcloud( {{00., 0.}, {10., 10.}, {20., 20.}, {30., -30.}, {40., 40.}, {50., -50.}} );
+    const idx_t nlev = 3;
+
+    Interpolation interpolation( option::type( "finite-element" ), fs, pointcloud );
+
+    FieldSet sources;
+    sources.add( fs.createField<double>( option::name( "a" ) ) );
+    sources.add( fs.createField<double>( option::name( "b" ) | option::levels( nlev ) ) );
+    sources.add( fs.createField<float>( option::name( "c" ) ) );
+
+    auto lonlat = array::make_view<double, 2>( fs.nodes().lonlat() );
+    auto a      = array::make_view<double, 1>( sources["a"] );
+    auto b      = array::make_view<double, 2>( sources["b"] );
+    auto c      = array::make_view<float, 1>( sources["c"] );
+    for ( idx_t j = 0; j < fs.nodes().size(); ++j ) {
+        a( j ) = std::cos( lonlat( j, LAT ) * M_PI / 180. );
+        for ( idx_t k = 0; k < nlev; ++k ) {
+            b( j, k ) = ( k + 1 ) * std::sin( lonlat( j, LON ) * M_PI / 180. );
+        }
+        c( j ) = static_cast<float>( lonlat( j, LAT ) );
+    }
+
+    auto make_targets = [&]() {
+        FieldSet targets;
+        targets.add( Field( "a", array::make_datatype<double>(), array::make_shape( pointcloud.size() ) ) );
+        targets.add( Field( "b", array::make_datatype<double>(), array::make_shape( pointcloud.size(), nlev ) ) );
+        targets.add( Field( "c", array::make_datatype<float>(), array::make_shape( pointcloud.size() ) ) );
+        return targets;
+    };
+
+    // Interpolating all fields at once must give the same result as interpolating them one by one
+    FieldSet fused = make_targets();
+    interpolation.execute( sources, fused );
+
+    FieldSet separate = make_targets();
+    for ( idx_t i = 0; i < sources.size(); ++i ) {
+        Field target = separate[i];
+        interpolation.execute( sources[i], target );
+    }
+
+    auto fused_a    = array::make_view<double, 1>( fused["a"] );
+    auto fused_b    = array::make_view<double, 2>( fused["b"] );
+    auto fused_c    = array::make_view<float, 1>( fused["c"] );
+    auto separate_a = array::make_view<double, 1>( separate["a"] );
+    auto separate_b = array::make_view<double, 2>( separate["b"] );
+    auto separate_c = array::make_view<float, 1>( separate["c"] );
+    for ( idx_t j = 0; j < pointcloud.size(); ++j ) {
+        EXPECT( eckit::types::is_approximately_equal( fused_a( j ), separate_a( j ), 1.e-12 ) );
+        for ( idx_t k = 0; k < nlev; ++k ) {
+            EXPECT( eckit::types::is_approximately_equal( fused_b( j, k ), separate_b( j, k ), 1.e-12 ) );
+        }
+        EXPECT( eckit::types::is_approximately_equal( fused_c( j ), separate_c( j ), 1.e-5f ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_interpolation_finite_element_cache" ) {
+    Grid grid( "O32" );
+    MeshGenerator meshgen( "structured" );
+    Mesh mesh = meshgen.generate( grid );
+    NodeColumns fs( mesh );
+
+    PointCloud pointcloud( {{00., 0.}, {10., 10.}, {20., 20.}, {30., -30.}, {40., 40.}, {50., -50.}} );
+
+    Field field_source = fs.createField<double>( option::name( "source" ) );
+    auto lonlat        = array::make_view<double, 2>( fs.nodes().lonlat() );
+    auto source        = array::make_view<double, 1>( field_source );
+    for ( idx_t j = 0; j < fs.nodes().size(); ++j ) {
+        source( j ) = std::cos( lonlat( j, LAT ) * M_PI / 180. ) * std::sin( lonlat( j, LON ) * M_PI / 180. );
+    }
+
+    auto interpolate = [&]( const Interpolation& interpolation ) {
+        Field field_target( "target", array::make_datatype<double>(), array::make_shape( pointcloud.size() ) );
+        interpolation.execute( field_source, field_target );
+        auto target = array::make_view<double, 1>( field_target );
+        return std::vector<double>( target.data(), target.data() + target.size() );
+    };
+
+    util::Config config( "type", "finite-element" );
+
+    Interpolation reference( config, fs, pointcloud );
+    auto expected = interpolate( reference );
+
+    interpolation::Cache cache = reference.createCache();
+    EXPECT( interpolation::MatrixCache( cache ) );
+
+    SECTION( "memory" ) {
+        Interpolation cached( config, fs, pointcloud, cache );
+        EXPECT( interpolate( cached ) == expected );
+    }
+
+    SECTION( "file" ) {
+        eckit::PathName path( "test_interpolation_finite_element_cache.matrix" );
+        interpolation::MatrixCache( cache ).save( path );
+        interpolation::MatrixCache loaded( path );
+        EXPECT( loaded.matrix().rows() == interpolation::MatrixCache( cache ).matrix().rows() );
+        EXPECT( loaded.matrix().nonZeros() == interpolation::MatrixCache( cache ).matrix().nonZeros() );
+
+        Interpolation cached( config, fs, pointcloud, loaded );
+        EXPECT( interpolate( cached ) == expected );
+        path.unlink();
+    }
+
+    SECTION( "cache_directory" ) {
+        eckit::PathName directory( "test_interpolation_finite_element_cache" );
+        auto cache_files = [&]() {
+            std::vector<eckit::PathName> files;
+            std::vector<eckit::PathName> directories;
+            if ( directory.exists() ) {
+                directory.children( files, directories );
+            }
+            return files;
+        };
+        auto remove_directory = [&]() {
+            for ( auto& file : cache_files() ) {
+                file.unlink();
+            }
+            if ( directory.exists() ) {
+                directory.rmdir();
+            }
+        };
+        remove_directory();
+
+        util::Config config_with_cache( config );
+        config_with_cache.set( "cache_directory", directory.asString() );
+
+        // First setup writes the cache file
+        Interpolation created( config_with_cache, fs, pointcloud );
+        EXPECT( interpolate( created ) == expected );
+        auto files = cache_files();
+        EXPECT( files.size() == 1 );
+
+        // Second setup takes its matrix from the file: replaced by a nearest-neighbour matrix of the same shape,
+        // its result is the nearest-neighbour interpolation
+        Interpolation nearest( util::Config( "type", "nearest-neighbour" ), fs, pointcloud );
+        auto expected_nearest = interpolate( nearest );
+        EXPECT( expected_nearest != expected );
+        interpolation::MatrixCache( nearest.createCache() ).save( files.front() );
+
+        Interpolation cached( config_with_cache, fs, pointcloud );
+        EXPECT( interpolate( cached ) == expected_nearest );
+
+        // A corrupt file is ignored: the matrix is recomputed and the file overwritten
+        {
+            std::ofstream garbage( files.front().localPath(), std::ios::binary | std::ios::trunc );
+            garbage << "not an interpolation matrix";
+        }
+        Interpolation recomputed( config_with_cache, fs, pointcloud );
+        EXPECT( interpolate( recomputed ) == expected );
+        EXPECT( cache_files().size() == 1 );
+        EXPECT( interpolation::MatrixCache( files.front() ).matrix().nonZeros() ==
+                interpolation::MatrixCache( cache ).matrix().nonZeros() );
+
+        remove_directory();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
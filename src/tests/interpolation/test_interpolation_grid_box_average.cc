@@ -9,7 +9,9 @@
  */
 
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "eckit/types/FloatCompare.h"
 
@@ -220,6 +222,41 @@ CASE( "test_interpolation_grid_box_average" ) {
 }
 
 
+CASE( "test_grid_box_candidates" ) {
+    // candidates from the rows of source grid boxes include every intersecting source grid box
+    auto check_candidates = []( const Grid& source, const Grid& target ) {
+        GridBoxes sourceBoxes( source );
+        GridBoxes targetBoxes( target );
+        EXPECT( sourceBoxes.structured() );
+
+        std::vector<size_t> candidates;
+        size_t nb_missing = 0;
+        for ( auto& box : targetBoxes ) {
+            sourceBoxes.candidates( box, candidates );
+            for ( size_t j = 0; j < sourceBoxes.size(); ++j ) {
+                auto smallBox = sourceBoxes[j];
+                if ( box.intersects( smallBox ) &&
+                     std::find( candidates.begin(), candidates.end(), j ) == candidates.end() ) {
+                    ++nb_missing;
+                }
+            }
+        }
+        EXPECT( nb_missing == 0 );
+    };
+
+    SECTION( "global source" ) {
+        check_candidates( Grid( "O16" ), Grid( "O24" ) );
+        check_candidates( Grid( "O16" ), Grid( Grid( "L72x37" ), RectangularDomain( {-27., 45.}, {33., 73.} ) ) );
+    }
+
+    SECTION( "regional source" ) {
+        Grid source( "L64x33", RectangularDomain( {-20., 40.}, {30., 60.} ) );
+        check_candidates( source, Grid( "O24" ) );
+        check_candidates( source, Grid( Grid( "L72x37" ), RectangularDomain( {-27., 45.}, {33., 73.} ) ) );
+    }
+}
+
+
 }  // namespace test
 }  // namespace atlas
 
@@ -132,6 +132,48 @@ CASE( "Interpolation with MissingValue" ) {
 }
 
 
+CASE( "NonLinear corrections leave the matrix unmodified" ) {
+    using Matrix      = interpolation::NonLinear::Matrix;
+    using Corrections = interpolation::NonLinear::Corrections;
+
+    // 3 target points, each interpolated from 2 of 4 source points; source point 2 is missing
+    const Matrix W( 3, 4, {{0, 0, 0.5}, {0, 1, 0.5}, {1, 1, 0.25}, {1, 2, 0.75}, {2, 2, 0.5}, {2, 3, 0.5}} );
+
+    Field field( "A", array::make_datatype<double>(), array::make_shape( 4 ) );
+    field.metadata().set( "missing_value", missingValue );
+    field.metadata().set( "missing_value_type", "equals" );
+    auto view = array::make_view<double, 1>( field );
+    view.assign( {1., 2., missingValue, 4.} );
+
+    for ( std::string type : {"missing-if-all-missing", "missing-if-any-missing", "missing-if-heaviest-missing"} ) {
+        interpolation::NonLinear nonLinear( type, Config() );
+
+        Matrix M( W );
+        EXPECT( nonLinear.execute( M, field ) );
+
+        Corrections corrections;
+        EXPECT( nonLinear.execute( W, field, corrections ) );
+        EXPECT( corrections.rows.size() == 2 );
+        EXPECT( corrections.rows[0] == 1 );
+        EXPECT( corrections.rows[1] == 2 );
+
+        for ( size_t j = 0; j < corrections.rows.size(); ++j ) {
+            const auto r = corrections.rows[j];
+            EXPECT( corrections.outer[j + 1] - corrections.outer[j] == size_t( M.outer()[r + 1] - M.outer()[r] ) );
+            for ( auto c = corrections.outer[j], m = size_t( M.outer()[r] ); c < corrections.outer[j + 1];
+                  ++c, ++m ) {
+                EXPECT( corrections.inner[c] == size_t( M.inner()[m] ) );
+                EXPECT( corrections.data[c] == M.data()[m] );
+            }
+        }
+
+        // original weights are untouched
+        EXPECT( W.data()[2] == 0.25 );
+        EXPECT( W.data()[3] == 0.75 );
+    }
+}
+
+
 }  // namespace test
 }  // namespace atlas
 
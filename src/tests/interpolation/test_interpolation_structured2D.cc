@@ -332,6 +332,36 @@ CASE( "test_interpolation_structured using fs API for fieldset" ) {
             gmsh.write( fields_target );
         }
     }
+
+    SECTION( "matrix free with cached weights" ) {
+        FieldSet fields_cached;
+        for ( idx_t f = 0; f < 3; ++f ) {
+            array::make_view<Value, 2>( fields_target[f] ).assign( 0. );
+            fields_cached.add( output_fs.createField<Value>() );
+        }
+
+        Interpolation interpolation( scheme() | Config( "matrix_free", true ), input_fs, output_fs );
+        interpolation.execute( fields_source, fields_target );
+
+        Interpolation cached( scheme() | Config( "matrix_free", true ) | Config( "cache_weights", true ), input_fs,
+                              output_fs );
+        // First execution fills the cache, second execution uses it
+        for ( int execution = 0; execution < 2; ++execution ) {
+            for ( idx_t f = 0; f < 3; ++f ) {
+                array::make_view<Value, 2>( fields_cached[f] ).assign( 0. );
+            }
+            cached.execute( fields_source, fields_cached );
+            for ( idx_t f = 0; f < 3; ++f ) {
+                auto expected = array::make_view<Value, 2>( fields_target[f] );
+                auto result   = array::make_view<Value, 2>( fields_cached[f] );
+                for ( idx_t n = 0; n < output_fs.size(); ++n ) {
+                    for ( idx_t k = 0; k < 3; ++k ) {
+                        EXPECT( result( n, k ) == expected( n, k ) );
+                    }
+                }
+            }
+        }
+    }
 }
 
 
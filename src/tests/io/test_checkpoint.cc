@@ -0,0 +1,408 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/field/State.h"
+#include "atlas/functionspace/EdgeColumns.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+#include "atlas/output/Checkpoint.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace atlas::functionspace;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+// Checkpoint directory specific to the number of tasks, so that serial and parallel tests can run concurrently,
+// removed on construction and destruction
+class CheckpointDirectory {
+public:
+    CheckpointDirectory( const std::string& name ) : path_( name + "-" + std::to_string( mpi::size() ) ) { remove(); }
+    ~CheckpointDirectory() { remove(); }
+    operator const eckit::PathName&() const { return path_; }
+
+private:
+    void remove() const {
+        mpi::comm().barrier();
+        if ( mpi::rank() == 0 && path_.exists() ) {
+            std::vector<eckit::PathName> files;
+            std::vector<eckit::PathName> directories;
+            path_.children( files, directories );
+            for ( auto& file : files ) {
+                file.unlink();
+            }
+            path_.rmdir();
+        }
+        mpi::comm().barrier();
+    }
+    eckit::PathName path_;
+};
+
+// Sets the default communicator for the lifetime of this object
+class DefaultComm {
+public:
+    DefaultComm( const std::string& name ) { eckit::mpi::setCommDefault( name.c_str() ); }
+    ~DefaultComm() { eckit::mpi::setCommDefault( "world" ); }
+};
+
+double value( gidx_t g, idx_t jlev ) {
+    return 1000. * double( g ) + double( jlev );
+}
+
+void fill( Field& temperature, Field& mask ) {
+    StructuredColumns fs( temperature.functionspace() );
+    auto g = array::make_view<gidx_t, 1>( fs.global_index() );
+    auto t = array::make_view<double, 2>( temperature );
+    auto m = array::make_view<int, 1>( mask );
+    for ( idx_t j = 0; j < fs.size(); ++j ) {
+        for ( idx_t jlev = 0; jlev < t.shape( 1 ); ++jlev ) {
+            t( j, jlev ) = value( g( j ), jlev );
+        }
+        m( j ) = static_cast<int>( g( j ) % 7 );
+    }
+}
+
+void zero( Field& temperature, Field& mask ) {
+    array::make_view<double, 2>( temperature ).assign( 0. );
+    array::make_view<int, 1>( mask ).assign( -1 );
+}
+
+bool check( const Field& temperature, const Field& mask ) {
+    StructuredColumns fs( temperature.functionspace() );
+    auto g      = array::make_view<gidx_t, 1>( fs.global_index() );
+    auto t      = array::make_view<double, 2>( temperature );
+    auto m      = array::make_view<int, 1>( mask );
+    idx_t wrong = 0;
+    for ( idx_t j = 0; j < fs.size(); ++j ) {
+        for ( idx_t jlev = 0; jlev < t.shape( 1 ); ++jlev ) {
+            if ( t( j, jlev ) != value( g( j ), jlev ) ) {
+                ++wrong;
+            }
+        }
+        if ( m( j ) != static_cast<int>( g( j ) % 7 ) ) {
+            ++wrong;
+        }
+    }
+    return wrong == 0;
+}
+
+template <typename Connectivity>
+bool equal( const Connectivity& a, const Connectivity& b ) {
+    if ( a.rows() != b.rows() ) {
+        return false;
+    }
+    for ( idx_t r = 0; r < a.rows(); ++r ) {
+        if ( a.cols( r ) != b.cols( r ) ) {
+            return false;
+        }
+        for ( idx_t c = 0; c < a.cols( r ); ++c ) {
+            if ( a( r, c ) != b( r, c ) ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Global index in owned nodes or edges, -1 in the others, followed by a halo exchange, so that periodic copies with
+// a global index of their own receive the global index of the point they copy
+Field exchanged_global_index( const FunctionSpace& fs ) {
+    Field field = fs.createField<double>( option::name( "global_index" ) );
+    auto f      = array::make_view<double, 1>( field );
+    if ( NodeColumns nodes_fs{fs} ) {
+        auto g     = array::make_view<gidx_t, 1>( nodes_fs.nodes().global_index() );
+        auto ghost = array::make_view<int, 1>( nodes_fs.nodes().ghost() );
+        for ( idx_t j = 0; j < nodes_fs.nb_nodes(); ++j ) {
+            f( j ) = ghost( j ) ? -1. : double( g( j ) );
+        }
+    }
+    else {
+        EdgeColumns edges_fs( fs );
+        auto g         = array::make_view<gidx_t, 1>( edges_fs.edges().global_index() );
+        auto partition = array::make_view<int, 1>( edges_fs.edges().partition() );
+        for ( idx_t j = 0; j < edges_fs.nb_edges(); ++j ) {
+            f( j ) = partition( j ) == static_cast<int>( mpi::rank() ) ? double( g( j ) ) : -1.;
+        }
+    }
+    fs.haloExchange( field );
+    return field;
+}
+
+// Values of a field on nodes or edges, in which halos and periodic copies hold the values of the points they copy
+void fill( Field& field ) {
+    Field global_index = exchanged_global_index( field.functionspace() );
+    auto g             = array::make_view<double, 1>( global_index );
+    auto f             = array::make_view<double, 2>( field );
+    for ( idx_t j = 0; j < f.shape( 0 ); ++j ) {
+        for ( idx_t jlev = 0; jlev < f.shape( 1 ); ++jlev ) {
+            f( j, jlev ) = value( static_cast<gidx_t>( g( j ) ), jlev );
+        }
+    }
+}
+
+bool check( const Field& field ) {
+    Field global_index = exchanged_global_index( field.functionspace() );
+    auto g             = array::make_view<double, 1>( global_index );
+    auto f             = array::make_view<double, 2>( field );
+    idx_t wrong        = 0;
+    for ( idx_t j = 0; j < f.shape( 0 ); ++j ) {
+        for ( idx_t jlev = 0; jlev < f.shape( 1 ); ++jlev ) {
+            if ( f( j, jlev ) != value( static_cast<gidx_t>( g( j ) ), jlev ) ) {
+                ++wrong;
+            }
+        }
+    }
+    return wrong == 0;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_checkpoint_state" ) {
+    StructuredGrid grid( "O16" );
+    StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), util::Config( "halo", 1 ) );
+
+    field::State state;
+    Field temperature = state.add( fs.createField<double>( option::name( "temperature" ) | option::levels( 5 ) ) );
+    Field mask        = state.add( fs.createField<int>( option::name( "mask" ) ) );
+    temperature.metadata().set( "units", "K" );
+    state.metadata().set( "step", 42 );
+    fill( temperature, mask );
+
+    CheckpointDirectory directory( "test_checkpoint_state" );
+    output::Checkpoint checkpoint( directory );
+    checkpoint.write( state );
+
+    auto names = checkpoint.field_names();
+    std::sort( names.begin(), names.end() );
+    EXPECT( names == ( std::vector<std::string>{"mask", "temperature"} ) );
+
+    field::State restart;
+    Field restart_temperature =
+        restart.add( fs.createField<double>( option::name( "temperature" ) | option::levels( 5 ) ) );
+    Field restart_mask = restart.add( fs.createField<int>( option::name( "mask" ) ) );
+    zero( restart_temperature, restart_mask );
+    checkpoint.read( restart );
+
+    EXPECT( check( restart_temperature, restart_mask ) );
+    EXPECT( restart_temperature.metadata().getString( "units" ) == "K" );
+    EXPECT( restart.metadata().getInt( "step" ) == 42 );
+}
+
+CASE( "test_checkpoint_redistribution" ) {
+    StructuredGrid grid( "O16" );
+
+    SECTION( "StructuredColumns" ) {
+        StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), util::Config( "halo", 1 ) );
+
+        FieldSet fields;
+        Field temperature = fields.add( fs.createField<double>( option::name( "temperature" ) | option::levels( 3 ) ) );
+        Field mask        = fields.add( fs.createField<int>( option::name( "mask" ) ) );
+        fill( temperature, mask );
+
+        CheckpointDirectory directory( "test_checkpoint_redistribution" );
+        output::Checkpoint checkpoint( directory );
+        checkpoint.write( fields );
+
+        // Different partitioning and a wider halo: owned points are found by global index, halos are exchanged
+        StructuredColumns restart_fs( grid, grid::Partitioner( "checkerboard" ), util::Config( "halo", 2 ) );
+        FieldSet restart;
+        Field restart_temperature =
+            restart.add( restart_fs.createField<double>( option::name( "temperature" ) | option::levels( 3 ) ) );
+        Field restart_mask = restart.add( restart_fs.createField<int>( option::name( "mask" ) ) );
+
+        for ( int repeat = 0; repeat < 2; ++repeat ) {
+            zero( restart_temperature, restart_mask );
+            checkpoint.read( restart );
+            EXPECT( check( restart_temperature, restart_mask ) );
+        }
+
+        Field wrong_levels = restart_fs.createField<double>( option::name( "temperature" ) | option::levels( 4 ) );
+        EXPECT_THROWS_AS( checkpoint.read( wrong_levels ), eckit::Exception );
+    }
+
+    SECTION( "NodeColumns and EdgeColumns" ) {
+        // Periodic nodes and edges have a global index of their own, which no task owns
+        Mesh mesh = meshgenerator::StructuredMeshGenerator().generate( grid, grid::Partitioner( "equal_regions" ) );
+        NodeColumns nodes_fs( mesh, option::halo( 1 ) );
+        EdgeColumns edges_fs( mesh, option::halo( 1 ) );
+
+        FieldSet fields;
+        fields.add( nodes_fs.createField<double>( option::name( "nodes" ) | option::levels( 3 ) ) );
+        fields.add( edges_fs.createField<double>( option::name( "edges" ) | option::levels( 3 ) ) );
+        fill( fields[0] );
+        fill( fields[1] );
+
+        CheckpointDirectory directory( "test_checkpoint_redistribution_mesh" );
+        output::Checkpoint checkpoint( directory );
+        checkpoint.write( fields );
+
+        Mesh restart_mesh =
+            meshgenerator::StructuredMeshGenerator().generate( grid, grid::Partitioner( "checkerboard" ) );
+        NodeColumns restart_nodes_fs( restart_mesh, option::halo( 2 ) );
+        EdgeColumns restart_edges_fs( restart_mesh, option::halo( 2 ) );
+
+        FieldSet restart;
+        restart.add( restart_nodes_fs.createField<double>( option::name( "nodes" ) | option::levels( 3 ) ) );
+        restart.add( restart_edges_fs.createField<double>( option::name( "edges" ) | option::levels( 3 ) ) );
+        array::make_view<double, 2>( restart[0] ).assign( 0. );
+        array::make_view<double, 2>( restart[1] ).assign( 0. );
+        checkpoint.read( restart );
+        EXPECT( check( restart[0] ) );
+        EXPECT( check( restart[1] ) );
+    }
+}
+
+CASE( "test_checkpoint_different_task_count" ) {
+    CheckpointDirectory directory( "test_checkpoint_different_task_count" );
+    const idx_t rank = mpi::rank();
+    const idx_t size = mpi::size();
+    StructuredGrid grid( "O16" );
+
+    auto write = [&]() {
+        StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), util::Config( "halo", 1 ) );
+        Mesh mesh = meshgenerator::StructuredMeshGenerator().generate( grid, grid::Partitioner( "equal_regions" ) );
+        NodeColumns nodes_fs( mesh, option::halo( 1 ) );
+        EdgeColumns edges_fs( mesh, option::halo( 1 ) );
+        FieldSet fields;
+        Field temperature = fields.add( fs.createField<double>( option::name( "temperature" ) | option::levels( 3 ) ) );
+        Field mask        = fields.add( fs.createField<int>( option::name( "mask" ) ) );
+        Field nodes       = fields.add( nodes_fs.createField<double>( option::name( "nodes" ) | option::levels( 3 ) ) );
+        Field edges       = fields.add( edges_fs.createField<double>( option::name( "edges" ) | option::levels( 3 ) ) );
+        fill( temperature, mask );
+        fill( nodes );
+        fill( edges );
+        output::Checkpoint( directory ).write( fields );
+    };
+
+    auto read_and_check = [&]() {
+        StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), util::Config( "halo", 1 ) );
+        Mesh mesh = meshgenerator::StructuredMeshGenerator().generate( grid, grid::Partitioner( "equal_regions" ) );
+        NodeColumns nodes_fs( mesh, option::halo( 1 ) );
+        EdgeColumns edges_fs( mesh, option::halo( 1 ) );
+        FieldSet fields;
+        Field temperature = fields.add( fs.createField<double>( option::name( "temperature" ) | option::levels( 3 ) ) );
+        Field mask        = fields.add( fs.createField<int>( option::name( "mask" ) ) );
+        Field nodes       = fields.add( nodes_fs.createField<double>( option::name( "nodes" ) | option::levels( 3 ) ) );
+        Field edges       = fields.add( edges_fs.createField<double>( option::name( "edges" ) | option::levels( 3 ) ) );
+        zero( temperature, mask );
+        array::make_view<double, 2>( nodes ).assign( 0. );
+        array::make_view<double, 2>( edges ).assign( 0. );
+        output::Checkpoint( directory ).read( fields );
+        EXPECT( check( temperature, mask ) );
+        EXPECT( check( nodes ) );
+        EXPECT( check( edges ) );
+    };
+
+    SECTION( "written by fewer tasks" ) {
+        // Some tasks hold no checkpoint file
+        const idx_t nb_writers = ( size + 1 ) / 2;
+        mpi::comm().split( rank < nb_writers ? 0 : 1, "checkpoint_writers" );
+        if ( rank < nb_writers ) {
+            DefaultComm writers( "checkpoint_writers" );
+            write();
+        }
+        mpi::comm().barrier();
+        read_and_check();
+    }
+
+    SECTION( "read by fewer tasks" ) {
+        // Checkpoint files are distributed round-robin, so that some tasks hold several files
+        const idx_t nb_readers = std::max<idx_t>( 1, size - 1 );
+        write();
+        mpi::comm().split( rank < nb_readers ? 0 : 1, "checkpoint_readers" );
+        if ( rank < nb_readers ) {
+            DefaultComm readers( "checkpoint_readers" );
+            read_and_check();
+        }
+        mpi::comm().barrier();
+    }
+}
+
+CASE( "test_checkpoint_mesh" ) {
+    Grid grid( "O16" );
+    Mesh mesh = meshgenerator::StructuredMeshGenerator().generate( grid );
+    NodeColumns nodes_fs( mesh, option::halo( 1 ) );
+    EdgeColumns edges_fs( mesh, option::halo( 1 ) );
+
+    CheckpointDirectory directory( "test_checkpoint_mesh" );
+    output::Checkpoint checkpoint( directory );
+    checkpoint.write( mesh );
+
+    Mesh restart = checkpoint.read_mesh();
+    EXPECT( restart.grid().name() == grid.name() );
+    EXPECT( restart.nodes().size() == mesh.nodes().size() );
+    EXPECT( restart.cells().size() == mesh.cells().size() );
+    EXPECT( restart.edges().size() == mesh.edges().size() );
+    EXPECT( restart.cells().nb_types() == mesh.cells().nb_types() );
+    EXPECT( equal( restart.cells().node_connectivity(), mesh.cells().node_connectivity() ) );
+    EXPECT( equal( restart.edges().node_connectivity(), mesh.edges().node_connectivity() ) );
+    EXPECT( equal( restart.nodes().edge_connectivity(), mesh.nodes().edge_connectivity() ) );
+
+    auto g         = array::make_view<gidx_t, 1>( mesh.nodes().global_index() );
+    auto restart_g = array::make_view<gidx_t, 1>( restart.nodes().global_index() );
+    idx_t wrong    = 0;
+    for ( idx_t j = 0; j < mesh.nodes().size(); ++j ) {
+        wrong += restart_g( j ) != g( j );
+    }
+    EXPECT( wrong == 0 );
+
+    // Function spaces are created directly on the loaded mesh, without building halo or edges again
+    NodeColumns restart_nodes_fs( restart, option::halo( 1 ) );
+    EdgeColumns restart_edges_fs( restart, option::halo( 1 ) );
+    EXPECT( restart_nodes_fs.nb_nodes() == nodes_fs.nb_nodes() );
+    EXPECT( restart_edges_fs.nb_edges() == edges_fs.nb_edges() );
+
+    Field exchanged         = exchanged_global_index( nodes_fs );
+    Field restart_exchanged = exchanged_global_index( restart_nodes_fs );
+    auto x                  = array::make_view<double, 1>( exchanged );
+    auto restart_x          = array::make_view<double, 1>( restart_exchanged );
+    for ( idx_t j = 0; j < nodes_fs.nb_nodes(); ++j ) {
+        wrong += restart_x( j ) != x( j );
+    }
+    EXPECT( wrong == 0 );
+
+    // Modifying the loaded mesh does not modify the checkpoint
+    array::make_view<double, 2>( restart.nodes().lonlat() )( 0, 0 ) = -999.;
+    Mesh reread = checkpoint.read_mesh();
+    EXPECT( array::make_view<double, 2>( reread.nodes().lonlat() )( 0, 0 ) != -999. );
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
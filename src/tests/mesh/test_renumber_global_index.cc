@@ -0,0 +1,132 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/mesh/detail/RenumberGlobalIndex.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::mesh::detail::renumber_global_index;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+std::vector<gidx_t> all_gather( const std::vector<gidx_t>& local ) {
+    eckit::mpi::Buffer<gidx_t> recv( mpi::size() );
+    mpi::comm().allGatherv( local.begin(), local.end(), recv );
+    return std::vector<gidx_t>( recv.buffer.begin(), recv.buffer.end() );
+}
+
+// Pseudo-random identifiers in [0,range), different on every task
+std::vector<gidx_t> random_uid( size_t size, gidx_t range ) {
+    std::vector<gidx_t> uid( size );
+    unsigned long long state = 12345 + 1000 * mpi::rank();
+    for ( auto& u : uid ) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        u     = static_cast<gidx_t>( ( state >> 16 ) % static_cast<unsigned long long>( range ) );
+    }
+    return uid;
+}
+
+// Renumber uid and compare with the numbering of the sorted distinct identifiers of all tasks
+void check( const std::vector<gidx_t>& uid, gidx_t base ) {
+    std::vector<gidx_t> distinct = all_gather( uid );
+    std::sort( distinct.begin(), distinct.end() );
+    distinct.erase( std::unique( distinct.begin(), distinct.end() ), distinct.end() );
+
+    std::vector<gidx_t> gidx( uid );
+    const gidx_t max = renumber_global_index( gidx, base );
+    EXPECT_EQ( max, base + static_cast<gidx_t>( distinct.size() ) );
+
+    // Equal identifiers, also on different tasks, have equal global indices in the order of the identifiers
+    idx_t wrong = 0;
+    for ( size_t j = 0; j < uid.size(); ++j ) {
+        auto position = std::lower_bound( distinct.begin(), distinct.end(), uid[j] ) - distinct.begin();
+        if ( gidx[j] != base + 1 + position ) {
+            ++wrong;
+        }
+    }
+    EXPECT_EQ( wrong, 0 );
+
+    // All global indices in [base+1,max] are used
+    std::vector<gidx_t> used = all_gather( gidx );
+    std::sort( used.begin(), used.end() );
+    used.erase( std::unique( used.begin(), used.end() ), used.end() );
+    EXPECT_EQ( used.size(), distinct.size() );
+    if ( not used.empty() ) {
+        EXPECT_EQ( used.front(), base + 1 );
+        EXPECT_EQ( used.back(), max );
+    }
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_renumber_global_index" ) {
+    const idx_t rank = static_cast<idx_t>( mpi::rank() );
+    const idx_t size = static_cast<idx_t>( mpi::size() );
+
+    SECTION( "distinct uids" ) {
+        std::vector<gidx_t> uid;
+        for ( idx_t j = 0; j < 1000; ++j ) {
+            uid.emplace_back( 10 * ( ( 999 - j ) * size + rank ) );
+        }
+        check( uid, 0 );
+    }
+
+    SECTION( "duplicated uids" ) {
+        // Duplicated within tasks and shared between tasks
+        check( random_uid( 10000, 5000 ), 0 );
+    }
+
+    SECTION( "non-zero base" ) {
+        check( random_uid( 10000, 5000 ), 1000000 );
+    }
+
+    SECTION( "large uids" ) {
+        std::vector<gidx_t> uid = random_uid( 1000, 1000000 );
+        for ( auto& u : uid ) {
+            u = std::numeric_limits<gidx_t>::max() - 1000 * u;
+        }
+        check( uid, 0 );
+    }
+
+    SECTION( "tasks without uids" ) {
+        std::vector<gidx_t> uid;
+        if ( rank % 2 == 0 ) {
+            uid = random_uid( 1000, 800 );
+        }
+        check( uid, 5 );
+    }
+
+    SECTION( "no uids" ) {
+        std::vector<gidx_t> uid;
+        EXPECT_EQ( renumber_global_index( uid, 42 ), 42 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
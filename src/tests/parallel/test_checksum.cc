@@ -0,0 +1,89 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <string>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/parallel/Checksum.h"
+#include "atlas/parallel/GatherScatter.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Field create_field( const functionspace::StructuredColumns& fs ) {
+    Field field  = fs.createField<double>( option::levels( 5 ) );
+    auto value   = array::make_view<double, 2>( field );
+    auto glb_idx = array::make_view<gidx_t, 1>( fs.global_index() );
+    for ( idx_t n = 0; n < fs.size(); ++n ) {
+        for ( idx_t k = 0; k < value.shape( 1 ); ++k ) {
+            value( n, k ) = 0.1 * double( glb_idx( n ) ) + double( k );
+        }
+    }
+    return field;
+}
+
+std::string checksum( const functionspace::StructuredColumns& fs, const Field& field, bool with_gather ) {
+    auto part       = array::make_view<int, 1>( fs.partition() );
+    auto remote_idx = array::make_view<idx_t, 1>( fs.remote_index() );
+    auto glb_idx    = array::make_view<gidx_t, 1>( fs.global_index() );
+    parallel::Checksum checksum;
+    if ( with_gather ) {
+        util::ObjectHandle<parallel::GatherScatter> gather( new parallel::GatherScatter() );
+        gather->setup( part.data(), remote_idx.data(), 0, glb_idx.data(), fs.size() );
+        checksum.setup( gather );
+    }
+    else {
+        checksum.setup( part.data(), remote_idx.data(), 0, glb_idx.data(), fs.size() );
+    }
+    return checksum.execute( array::make_view<double, 2>( field ).data(), field.stride( 0 ) );
+}
+
+}  // namespace
+
+CASE( "test_checksum_independent_of_distribution" ) {
+    Grid grid( "O32" );
+    functionspace::StructuredColumns fs1( grid, grid::Partitioner( "equal_regions" ), util::Config( "halo", 1 ) );
+    functionspace::StructuredColumns fs2( grid, grid::Partitioner( "checkerboard" ), util::Config( "halo", 2 ) );
+
+    Field field1 = create_field( fs1 );
+    Field field2 = create_field( fs2 );
+
+    std::string checksum1 = checksum( fs1, field1, false );
+    EXPECT_EQ( checksum( fs1, field1, true ), checksum1 );
+    EXPECT_EQ( checksum( fs2, field2, false ), checksum1 );
+    EXPECT_EQ( checksum( fs2, field2, true ), checksum1 );
+
+    // Changing the value of a single point changes the checksum
+    if ( mpi::rank() == 0 ) {
+        array::make_view<double, 2>( field2 )( 0, 3 ) += 1.;
+    }
+    EXPECT( checksum( fs2, field2, false ) != checksum1 );
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
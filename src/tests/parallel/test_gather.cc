@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <sstream>
 
 #include "atlas/array.h"
@@ -609,6 +610,91 @@ CASE( "test_gather" ) {
         f.root = 0;
     }
 
+    SECTION( "test_gather_multiple_roots" ) {
+        // Fields are gathered round-robin on all tasks, in a single call
+        const idx_t nb_fields = 4;
+        std::vector<idx_t> roots( nb_fields );
+        std::vector<std::unique_ptr<array::Array>> loc;
+        std::vector<std::unique_ptr<array::Array>> glb;
+        for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+            roots[jfield] = jfield % f.comm_size;
+            f.root        = roots[jfield];
+            loc.emplace_back( array::Array::create<POD>( f.Nl, 2 ) );
+            glb.emplace_back( array::Array::create<POD>( f.Ng(), 2 ) );
+        }
+
+        std::vector<parallel::Field<POD const>> lfields;
+        std::vector<parallel::Field<POD>> gfields;
+        for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+            auto locv = array::make_view<POD, 2>( *loc[jfield] );
+            for ( int p = 0; p < f.Nl; ++p ) {
+                locv( p, 0 ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : -f.gidx[p] * ( jfield + 1 ) );
+                locv( p, 1 ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : f.gidx[p] * ( jfield + 1 ) );
+            }
+            lfields.emplace_back( locv );
+            gfields.emplace_back( array::make_view<POD, 2>( *glb[jfield] ) );
+        }
+
+        // Gather in a single batch or one field at a time, keeping communication buffers or not
+        const size_t max_message_size = f.gather_scatter.max_message_size();
+        for ( int repeat = 0; repeat < 4; ++repeat ) {
+            f.gather_scatter.max_message_size( repeat % 2 ? 1 : max_message_size );
+            f.gather_scatter.keep_buffers( repeat < 2 );
+            for ( auto& glb_field : glb ) {
+                array::make_view<POD, 2>( *glb_field ).assign( 0 );
+            }
+            f.gather_scatter.gather( lfields.data(), gfields.data(), nb_fields, roots.data() );
+
+            for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+                if ( f.rank == roots[jfield] ) {
+                    auto glbv = array::make_view<POD, 2>( *glb[jfield] );
+                    EXPECT( glbv.shape( 0 ) == 9 );
+                    for ( idx_t n = 0; n < glbv.shape( 0 ); ++n ) {
+                        EXPECT( glbv( n, 0 ) == -POD( ( n + 1 ) * ( jfield + 1 ) ) );
+                        EXPECT( glbv( n, 1 ) == POD( ( n + 1 ) * ( jfield + 1 ) ) );
+                    }
+                }
+            }
+        }
+        f.gather_scatter.max_message_size( max_message_size );
+        f.gather_scatter.keep_buffers( false );
+        f.root = 0;
+    }
+
+    SECTION( "test_gather_chunked" ) {
+        array::ArrayT<POD> loc( f.Nl, 2 );
+        array::ArrayView<POD, 2> locv = array::make_view<POD, 2>( loc );
+        for ( int p = 0; p < f.Nl; ++p ) {
+            locv( p, 0 ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : -f.gidx[p] * 10 );
+            locv( p, 1 ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : f.gidx[p] * 10 );
+        }
+
+        for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
+            for ( idx_t chunk_size : {1, 4, 100} ) {
+                std::vector<POD> glb;
+                gidx_t next = 0;
+                f.gather_scatter.gather_chunked(
+                    locv,
+                    [&]( gidx_t begin, gidx_t end, const POD values[] ) {
+                        EXPECT( begin == next );
+                        EXPECT( end > begin && end - begin <= chunk_size );
+                        glb.insert( glb.end(), values, values + 2 * ( end - begin ) );
+                        next = end;
+                    },
+                    chunk_size, f.root );
+
+                if ( f.rank == f.root ) {
+                    POD glb_c[] = {-10, 10, -20, 20, -30, 30, -40, 40, -50, 50, -60, 60, -70, 70, -80, 80, -90, 90};
+                    EXPECT( glb == eckit::testing::make_view( glb_c, glb_c + 18 ) );
+                }
+                else {
+                    EXPECT( glb.empty() );
+                }
+            }
+        }
+        f.root = 0;
+    }
+
     SECTION( "test_scatter_rank2_ArrayView" ) {
         for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
             array::ArrayT<POD> loc( f.Nl, 3, 2 );
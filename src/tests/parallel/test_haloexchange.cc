@@ -680,6 +680,156 @@ void test_rank1_cinterface( Fixture& f ) {
 #endif
 }
 
+void test_rank1_repeated( Fixture& f ) {
+    // Repeated exchanges with alternating shapes reuse the communication plans of previous calls
+    array::ArrayT<POD> arr1( f.N, 2 );
+    array::ArrayT<POD> arr0( f.N );
+    array::ArrayView<POD, 2> arrv1 = array::make_host_view<POD, 2>( arr1 );
+    array::ArrayView<POD, 1> arrv0 = array::make_host_view<POD, 1>( arr0 );
+    for ( int iter = 0; iter < 3; ++iter ) {
+        for ( int j = 0; j < f.N; ++j ) {
+            arrv1( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 10 );
+            arrv1( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 100 );
+            arrv0( j )    = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] );
+        }
+
+        f.halo_exchange.execute<POD, 2>( arr1, false );
+        f.halo_exchange.execute<POD, 1>( arr0, false );
+
+        switch ( mpi::comm().rank() ) {
+            case 0: {
+                POD arr1_c[] = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+                POD arr0_c[] = {9, 1, 2, 3, 4};
+                validate<POD, 2>::apply( arrv1, arr1_c );
+                validate<POD, 1>::apply( arrv0, arr0_c );
+                break;
+            }
+            case 1: {
+                POD arr1_c[] = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+                POD arr0_c[] = {3, 4, 5, 6, 7, 8};
+                validate<POD, 2>::apply( arrv1, arr1_c );
+                validate<POD, 1>::apply( arrv0, arr0_c );
+                break;
+            }
+            case 2: {
+                POD arr1_c[] = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+                POD arr0_c[] = {5, 6, 7, 8, 9, 1, 2};
+                validate<POD, 2>::apply( arrv1, arr1_c );
+                validate<POD, 1>::apply( arrv0, arr0_c );
+                break;
+            }
+        }
+    }
+}
+
+void test_multiple_arrays( Fixture& f ) {
+    // Arrays of different data types and ranks exchanged in a single message per task
+    array::ArrayT<float> arr0( f.N );
+    array::ArrayT<POD> arr1( f.N, 2 );
+    array::ArrayT<int> arr2( f.N, 3, 2 );
+    auto arrv0 = array::make_host_view<float, 1>( arr0 );
+    auto arrv1 = array::make_host_view<POD, 2>( arr1 );
+    auto arrv2 = array::make_host_view<int, 3>( arr2 );
+    for ( int j = 0; j < f.N; ++j ) {
+        bool ghost = size_t( f.part[j] ) != mpi::comm().rank();
+        arrv0( j )    = ghost ? 0 : f.gidx[j];
+        arrv1( j, 0 ) = ghost ? 0 : f.gidx[j] * 10;
+        arrv1( j, 1 ) = ghost ? 0 : f.gidx[j] * 100;
+        for ( idx_t i = 0; i < 3; ++i ) {
+            arrv2( j, i, 0 ) = ghost ? 0 : -f.gidx[j] * std::pow( 10, i );
+            arrv2( j, i, 1 ) = ghost ? 0 : f.gidx[j] * std::pow( 10, i );
+        }
+    }
+
+    std::vector<array::Array*> arrays{&arr0, &arr1, &arr2};
+    f.halo_exchange.execute( arrays, false );
+
+    switch ( mpi::comm().rank() ) {
+        case 0: {
+            float arr0_c[] = {9, 1, 2, 3, 4};
+            POD arr1_c[]   = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+            int arr2_c[]   = {-9, 9, -90, 90, -900, 900, -1, 1, -10, 10, -100, 100, -2, 2, -20, 20, -200, 200,
+                            -3, 3, -30, 30, -300, 300, -4, 4, -40, 40, -400, 400};
+            validate<float, 1>::apply( arrv0, arr0_c );
+            validate<POD, 2>::apply( arrv1, arr1_c );
+            validate<int, 3>::apply( arrv2, arr2_c );
+            break;
+        }
+        case 1: {
+            float arr0_c[] = {3, 4, 5, 6, 7, 8};
+            POD arr1_c[]   = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+            int arr2_c[]   = {-3, 3, -30, 30, -300, 300, -4, 4, -40, 40, -400, 400, -5, 5, -50, 50, -500, 500,
+                            -6, 6, -60, 60, -600, 600, -7, 7, -70, 70, -700, 700, -8, 8, -80, 80, -800, 800};
+            validate<float, 1>::apply( arrv0, arr0_c );
+            validate<POD, 2>::apply( arrv1, arr1_c );
+            validate<int, 3>::apply( arrv2, arr2_c );
+            break;
+        }
+        case 2: {
+            float arr0_c[] = {5, 6, 7, 8, 9, 1, 2};
+            POD arr1_c[]   = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+            int arr2_c[]   = {-5, 5, -50, 50, -500, 500, -6, 6, -60, 60, -600, 600, -7, 7, -70, 70, -700, 700,
+                            -8, 8, -80, 80, -800, 800, -9, 9, -90, 90, -900, 900, -1, 1, -10, 10, -100, 100,
+                            -2, 2, -20, 20, -200, 200};
+            validate<float, 1>::apply( arrv0, arr0_c );
+            validate<POD, 2>::apply( arrv1, arr1_c );
+            validate<int, 3>::apply( arrv2, arr2_c );
+            break;
+        }
+    }
+}
+
+void test_split_phase( Fixture& f ) {
+    // Two exchanges in flight at the same time, completed in reverse order
+    array::ArrayT<POD> arr1( f.N, 2 );
+    array::ArrayT<POD> arr0( f.N );
+    array::ArrayView<POD, 2> arrv1 = array::make_host_view<POD, 2>( arr1 );
+    array::ArrayView<POD, 1> arrv0 = array::make_host_view<POD, 1>( arr0 );
+    for ( int j = 0; j < f.N; ++j ) {
+        arrv1( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 10 );
+        arrv1( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 100 );
+        arrv0( j )    = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] );
+    }
+
+    bool completed = false;
+    auto handle1   = f.halo_exchange.execute_start( {&arr1} );
+    auto handle0   = f.halo_exchange.execute_start( {&arr0} );
+    handle1.on_completion( [&]() { completed = true; } );
+    EXPECT( handle0.active() );
+    EXPECT( handle1.active() );
+    EXPECT( not completed );
+
+    handle0.wait();
+    EXPECT( not handle0.active() );
+    handle1.wait();
+    EXPECT( not handle1.active() );
+    EXPECT( completed );
+
+    switch ( mpi::comm().rank() ) {
+        case 0: {
+            POD arr1_c[] = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+            POD arr0_c[] = {9, 1, 2, 3, 4};
+            validate<POD, 2>::apply( arrv1, arr1_c );
+            validate<POD, 1>::apply( arrv0, arr0_c );
+            break;
+        }
+        case 1: {
+            POD arr1_c[] = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+            POD arr0_c[] = {3, 4, 5, 6, 7, 8};
+            validate<POD, 2>::apply( arrv1, arr1_c );
+            validate<POD, 1>::apply( arrv0, arr0_c );
+            break;
+        }
+        case 2: {
+            POD arr1_c[] = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+            POD arr0_c[] = {5, 6, 7, 8, 9, 1, 2};
+            validate<POD, 2>::apply( arrv1, arr1_c );
+            validate<POD, 1>::apply( arrv0, arr0_c );
+            break;
+        }
+    }
+}
+
 CASE( "test_haloexchange" ) {
     Fixture f( false );
 
@@ -706,6 +856,12 @@ CASE( "test_haloexchange" ) {
     SECTION( "test_rank2_paralleldim_2" ) { test_rank2_paralleldim2( f ); }
     SECTION( "test_rank1_cinterface" ) { test_rank1_cinterface( f ); }
 
+    SECTION( "test_rank1_repeated" ) { test_rank1_repeated( f ); }
+
+    SECTION( "test_multiple_arrays" ) { test_multiple_arrays( f ); }
+
+    SECTION( "test_split_phase" ) { test_split_phase( f ); }
+
 #if ATLAS_GRIDTOOLS_STORAGE_BACKEND_CUDA
     f.on_device_ = true;
 
@@ -9,6 +9,13 @@
  */
 
 
+#include <algorithm>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/functionspace/PointCloud.h"
+#include "atlas/grid.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/projection.h"
 #include "atlas/util/Config.h"
 #include "atlas/util/Point.h"
@@ -50,6 +57,62 @@ CASE( "test_proj" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "test_proj_grid_multithreaded" ) {
+    util::Config gridspec;
+    gridspec.set( "type", "regional" );
+    gridspec.set( "nx", 300 );
+    gridspec.set( "ny", 200 );
+    gridspec.set( "dx", 5000 );
+    gridspec.set( "dy", 5000 );
+    gridspec.set( "lonlat(centre)", std::vector<double>{9., 55.} );
+    gridspec.set( "projection", util::Config( "type", "proj" ).set( "proj", "+proj=utm +zone=32 +datum=WGS84" ) );
+    Grid grid( gridspec );
+
+    // Reference computed point by point, without threads
+    std::vector<PointLonLat> ref;
+    ref.reserve( grid.size() );
+    for ( auto& p : grid.lonlat() ) {
+        ref.emplace_back( p );
+    }
+
+    auto check_lonlat = []( const std::vector<PointLonLat>& ref, const double lonlat[] ) {
+        size_t nb_wrong = 0;
+        for ( size_t j = 0; j < ref.size(); ++j ) {
+            if ( not is_approximately_equal( lonlat[2 * j + 0], ref[j].lon(), 1.e-9 ) ||
+                 not is_approximately_equal( lonlat[2 * j + 1], ref[j].lat(), 1.e-9 ) ) {
+                ++nb_wrong;
+            }
+        }
+        EXPECT_EQ( nb_wrong, 0 );
+    };
+
+    const int nb_threads = atlas_omp_get_max_threads();
+    atlas_omp_set_num_threads( std::max( nb_threads, 4 ) );
+
+    SECTION( "PointCloud" ) {
+        functionspace::PointCloud pointcloud( grid );
+        EXPECT_EQ( pointcloud.size(), grid.size() );
+        check_lonlat( ref, array::make_view<double, 2>( pointcloud.lonlat() ).data() );
+    }
+
+    SECTION( "concurrent lonlat blocks" ) {
+        const gidx_t size       = grid.size();
+        const gidx_t block_size = 1000;
+        const gidx_t nb_blocks  = ( size + block_size - 1 ) / block_size;
+        std::vector<double> lonlat( 2 * size );
+        atlas_omp_parallel_for( gidx_t block = 0; block < nb_blocks; ++block ) {
+            const gidx_t begin = block * block_size;
+            const gidx_t end   = std::min( begin + block_size, size );
+            grid.lonlat().fill( begin, end, lonlat.data() + 2 * begin );
+        }
+        check_lonlat( ref, lonlat.data() );
+    }
+
+    atlas_omp_set_num_threads( nb_threads );
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -0,0 +1,79 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <vector>
+
+#include "atlas/projection/Projection.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<Config> projections() {
+    return {Config( "type", "lonlat" ),
+            Config( "type", "rotated_lonlat" )( "north_pole", std::vector<double>{-176., 40.} ),
+            Config( "type", "schmidt" )( "stretching_factor", 2.4 ),
+            Config( "type", "rotated_schmidt" )( "stretching_factor", 2.4 )( "rotation_angle", 180. )(
+                "north_pole", std::vector<double>{2., 46.7} ),
+            Config( "type", "mercator" )( "latitude1", 14. ),
+            Config( "type", "lambert_conformal_conic" )( "longitude0", 2. )( "latitude0", 46.2 ),
+            Config( "type", "lambert_azimuthal_equal_area" )( "central_longitude", -67. )( "standard_parallel", 50. )};
+}
+
+CASE( "test_batched_projection_matches_pointwise_projection" ) {
+    // More points than the threshold for multi-threading, and a stride larger than 2
+    const size_t n      = 3000;
+    const size_t stride = 3;
+    std::vector<double> lonlat( n * stride );
+    for ( size_t j = 0; j < n; ++j ) {
+        lonlat[j * stride + 0] = -30. + 60. * double( j % 100 ) / 100.;
+        lonlat[j * stride + 1] = 20. + 40. * double( j / 100 ) / double( n / 100 );
+        lonlat[j * stride + 2] = double( j );
+    }
+
+    for ( const auto& config : projections() ) {
+        Projection projection( config );
+        Log::info() << projection.type() << std::endl;
+
+        std::vector<double> xy( n * stride, -1. );
+        projection.lonlat2xy( lonlat.data(), xy.data(), n, stride );
+        for ( size_t j = 0; j < n; ++j ) {
+            PointXY p = projection.xy( PointLonLat( lonlat[j * stride], lonlat[j * stride + 1] ) );
+            EXPECT_EQ( xy[j * stride + 0], p.x() );
+            EXPECT_EQ( xy[j * stride + 1], p.y() );
+            EXPECT_EQ( xy[j * stride + 2], -1. );  // not touched
+        }
+
+        // In place
+        std::vector<double> crd( xy );
+        projection.xy2lonlat( crd.data(), crd.data(), n, stride );
+        for ( size_t j = 0; j < n; ++j ) {
+            PointLonLat p = projection.lonlat( PointXY( xy[j * stride], xy[j * stride + 1] ) );
+            EXPECT_EQ( crd[j * stride + 0], p.lon() );
+            EXPECT_EQ( crd[j * stride + 1], p.lat() );
+            EXPECT_APPROX_EQ( crd[j * stride + 1], lonlat[j * stride + 1], 1.e-9 );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
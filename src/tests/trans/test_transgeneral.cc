@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 #include "atlas/array/MakeView.h"
@@ -487,6 +488,10 @@ double compute_rms( const size_t N,    // length of the arrays
 #if 1
 CASE( "test_trans_vordiv_with_translib" ) {
     Log::info() << "test_trans_vordiv_with_translib" << std::endl;
+    if ( mpi::comm().size() > 1 ) {
+        Log::info() << "test_trans_vordiv_with_translib compares global fields and runs on a single task only" << std::endl;
+        return;
+    }
     // test transgeneral by comparing its result with the trans library
     // this test is based on the test_nomesh case in test_trans.cc
 
@@ -726,6 +731,10 @@ CASE( "test_trans_hires" ) {
 #if 1
 CASE( "test_trans_domain" ) {
     Log::info() << "test_trans_domain" << std::endl;
+    if ( mpi::comm().size() > 1 ) {
+        Log::info() << "test_trans_domain compares global fields and runs on a single task only" << std::endl;
+        return;
+    }
     // test transgeneral by comparing with analytic solution on a cropped domain
     // this test also includes testing caching
 
@@ -924,6 +933,10 @@ CASE( "test_trans_domain" ) {
 //-----------------------------------------------------------------------------
 CASE( "test_trans_pole" ) {
     Log::info() << "test_trans_pole" << std::endl;
+    if ( mpi::comm().size() > 1 ) {
+        Log::info() << "test_trans_pole compares global fields and runs on a single task only" << std::endl;
+        return;
+    }
     // test transform at the pole and with LinearSpacing grids
     // not using caching in this test because not useful for LinearSpacing grids
 
@@ -1112,6 +1125,10 @@ CASE( "test_trans_pole" ) {
 #if 1
 CASE( "test_trans_southpole" ) {
     Log::info() << "test_trans_southpole" << std::endl;
+    if ( mpi::comm().size() > 1 ) {
+        Log::info() << "test_trans_southpole compares global fields and runs on a single task only" << std::endl;
+        return;
+    }
     // test created for MIR-283 (limited area domain on the southern hemisphere with L-grid)
 
 
@@ -1304,6 +1321,10 @@ CASE( "test_trans_southpole" ) {
 #if 1
 CASE( "test_trans_unstructured" ) {
     Log::info() << "test_trans_unstructured" << std::endl;
+    if ( mpi::comm().size() > 1 ) {
+        Log::info() << "test_trans_unstructured compares global fields and runs on a single task only" << std::endl;
+        return;
+    }
     // test transgeneral by comparing with analytic solution on an unstructured grid
 
     double tolerance = 1.e-13;
@@ -1460,6 +1481,156 @@ CASE( "test_trans_unstructured" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "test_trans_dirtrans_local" ) {
+    Log::info() << "test_trans_dirtrans_local" << std::endl;
+    // test direct transforms of TransLocal by transforming back and forth (global Gaussian grids only)
+    auto max_error = []( const std::vector<double>& a, const std::vector<double>& b ) {
+        double err = 0., ref = 0.;
+        for ( size_t j = 0; j < a.size(); ++j ) {
+            err = std::max( err, std::abs( a[j] - b[j] ) );
+            ref = std::max( ref, std::abs( a[j] ) );
+        }
+        return err / ref;
+    };
+
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    for ( std::string gridname : {"F32", "O32"} ) {
+        Grid g( gridname );
+        double tolerance = grid::RegularGrid( g ) ? 1.e-10 : 1.e-6;
+        trans::Trans trans( g, trc, option::type( "local" ) );
+
+        // spectral data which can be represented on the grid (no imaginary part for m=0, m<trc for scalars):
+        std::vector<double> sp( 2 * N ), vor( 2 * N ), div( 2 * N );
+        int k = 0;
+        for ( int m = 0; m <= trc; m++ ) {                 // zonal wavenumber
+            for ( int n = m; n <= trc; n++ ) {             // total wavenumber
+                for ( int imag = 0; imag <= 1; imag++ ) {  // real and imaginary part
+                    bool zero = ( imag == 1 && m == 0 );
+                    sp[k]     = ( zero || m == trc ) ? 0. : 1. / ( 1. + n + 0.5 * m + imag );
+                    vor[k]    = ( zero || n == 0 ) ? 0. : 1.e-5 * std::cos( n + 2. * m + imag );
+                    div[k]    = ( zero || n == 0 ) ? 0. : 1.e-5 * std::sin( 2. * n + m + imag );
+                    k++;
+                }
+            }
+        }
+
+        {
+            std::vector<double> gp( g.size() );
+            std::vector<double> sp_dir( 2 * N );
+            trans.invtrans( 1, sp.data(), gp.data() );
+            trans.dirtrans( 1, gp.data(), sp_dir.data() );
+            double err = max_error( sp, sp_dir );
+            Log::info() << gridname << " scalar roundtrip error: " << err << std::endl;
+            EXPECT( err < tolerance );
+        }
+
+        {
+            std::vector<double> gp( 2 * g.size() );
+            std::vector<double> vor_dir( 2 * N ), div_dir( 2 * N );
+            trans.invtrans( 1, vor.data(), div.data(), gp.data() );
+            trans.dirtrans( 1, gp.data(), vor_dir.data(), div_dir.data() );
+            double err_vor = max_error( vor, vor_dir );
+            double err_div = max_error( div, div_dir );
+            Log::info() << gridname << " vordiv roundtrip error: " << err_vor << " " << err_div << std::endl;
+            EXPECT( err_vor < tolerance );
+            EXPECT( err_div < tolerance );
+        }
+    }
+
+    {
+        // no quadrature available for other grids
+        Grid g( "L16" );
+        trans::Trans trans( g, trc, option::type( "local" ) );
+        std::vector<double> gp( g.size(), 1. );
+        std::vector<double> sp( 2 * N );
+        EXPECT_THROWS_AS( trans.dirtrans( 1, gp.data(), sp.data() ), eckit::NotImplemented );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_trans_local_structuredcolumns" ) {
+    Log::info() << "test_trans_local_structuredcolumns" << std::endl;
+    // compare TransLocal on a (distributed) StructuredColumns function space with TransLocal on the whole grid
+    auto max_error = []( const std::vector<double>& a, const std::vector<double>& b ) {
+        double err = 0., ref = 0.;
+        for ( size_t j = 0; j < a.size(); ++j ) {
+            err = std::max( err, std::abs( a[j] - b[j] ) );
+            ref = std::max( ref, std::abs( b[j] ) );
+        }
+        return err / ref;
+    };
+
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    std::vector<double> sp( 2 * N ), vor( 2 * N ), div( 2 * N );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {                 // zonal wavenumber
+        for ( int n = m; n <= trc; n++ ) {             // total wavenumber
+            for ( int imag = 0; imag <= 1; imag++ ) {  // real and imaginary part
+                bool zero = ( imag == 1 && m == 0 );
+                sp[k]     = ( zero || m == trc ) ? 0. : 1. / ( 1. + n + 0.5 * m + imag );
+                vor[k]    = ( zero || n == 0 ) ? 0. : 1.e-5 * std::cos( n + 2. * m + imag );
+                div[k]    = ( zero || n == 0 ) ? 0. : 1.e-5 * std::sin( 2. * n + m + imag );
+                k++;
+            }
+        }
+    }
+
+    for ( std::string gridname : {"F32", "O32"} ) {
+        for ( std::string partitioner : {"equal_regions", "checkerboard"} ) {
+            Grid g( gridname );
+            functionspace::StructuredColumns gridpoints( g, grid::Partitioner( partitioner ) );
+            functionspace::Spectral spectral( trc );
+            trans::Trans trans( gridpoints, spectral, option::type( "local" ) );
+            trans::Trans trans_global( g, trc, option::type( "local" ) );
+
+            const idx_t nb_owned = gridpoints.sizeOwned();
+            const idx_t nb_gp    = g.size();
+            auto glb_idx         = array::make_view<gidx_t, 1>( gridpoints.global_index() );
+
+            {
+                std::vector<double> gp( nb_owned ), gp_global( nb_gp );
+                trans.invtrans( 1, sp.data(), gp.data() );
+                trans_global.invtrans( 1, sp.data(), gp_global.data() );
+                std::vector<double> gp_ref( nb_owned );
+                for ( idx_t jnode = 0; jnode < nb_owned; ++jnode ) {
+                    gp_ref[jnode] = gp_global[glb_idx( jnode ) - 1];
+                }
+                EXPECT( max_error( gp, gp_ref ) < 1.e-12 );
+
+                std::vector<double> sp_dir( 2 * N ), sp_dir_global( 2 * N );
+                trans.dirtrans( 1, gp.data(), sp_dir.data() );
+                trans_global.dirtrans( 1, gp_global.data(), sp_dir_global.data() );
+                EXPECT( max_error( sp_dir, sp_dir_global ) < 1.e-12 );
+            }
+
+            {
+                std::vector<double> gp( 2 * nb_owned ), gp_global( 2 * nb_gp );
+                trans.invtrans( 1, vor.data(), div.data(), gp.data() );
+                trans_global.invtrans( 1, vor.data(), div.data(), gp_global.data() );
+                std::vector<double> gp_ref( 2 * nb_owned );
+                for ( int jfld = 0; jfld < 2; ++jfld ) {
+                    for ( idx_t jnode = 0; jnode < nb_owned; ++jnode ) {
+                        gp_ref[jnode + jfld * nb_owned] = gp_global[glb_idx( jnode ) - 1 + jfld * nb_gp];
+                    }
+                }
+                EXPECT( max_error( gp, gp_ref ) < 1.e-12 );
+
+                std::vector<double> vor_dir( 2 * N ), div_dir( 2 * N );
+                std::vector<double> vor_dir_global( 2 * N ), div_dir_global( 2 * N );
+                trans.dirtrans( 1, gp.data(), vor_dir.data(), div_dir.data() );
+                trans_global.dirtrans( 1, gp_global.data(), vor_dir_global.data(), div_dir_global.data() );
+                EXPECT( max_error( vor_dir, vor_dir_global ) < 1.e-12 );
+                EXPECT( max_error( div_dir, div_dir_global ) < 1.e-12 );
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 #if 0
 CASE( "test_trans_fourier_truncation" ) {
     Log::info() << "test_trans_fourier_truncation" << std::endl;
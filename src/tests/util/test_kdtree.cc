@@ -245,6 +245,35 @@ CASE( "test closestPoints" ) {
     EXPECT_EQ( neighbours, expected_neighbours );
 }
 
+CASE( "test closestPoints for many points" ) {
+    std::vector<PointLonLat> points;
+    for ( double lat = -89.; lat <= 89.; lat += 7. ) {
+        for ( double lon = 0.; lon < 360.; lon += 11. ) {
+            points.emplace_back( lon, lat );
+        }
+    }
+    points.emplace_back( 180., 45. );
+
+    auto neighbours = search().closestPoints( points, 4 );
+    auto nearest    = search().closestPoint( points );
+    EXPECT_EQ( neighbours.size(), points.size() );
+    EXPECT_EQ( nearest.size(), points.size() );
+    for ( size_t j = 0; j < points.size(); ++j ) {
+        EXPECT_EQ( neighbours[j].payloads(), search().closestPoints( points[j], 4 ).payloads() );
+        EXPECT_EQ( nearest[j].payload(), search().closestPoint( points[j] ).payload() );
+    }
+    EXPECT_EQ( neighbours.back().payloads(), ( std::vector<idx_t>{760, 842, 759, 761} ) );
+
+    std::vector<PointXYZ> points_xyz;
+    for ( const auto& p : points ) {
+        points_xyz.emplace_back( make_xyz( p ) );
+    }
+    auto neighbours_xyz = search().closestPoints( points_xyz, 4 );
+    for ( size_t j = 0; j < points.size(); ++j ) {
+        EXPECT_EQ( neighbours_xyz[j].payloads(), neighbours[j].payloads() );
+    }
+}
+
 CASE( "test closestPointsWithinRadius" ) {
     double km                = 1000. * radius() / util::Earth::radius();
     auto neighbours          = search().closestPointsWithinRadius( PointLonLat{180., 45.}, 500 * km ).payloads();